@@ -11,7 +11,9 @@ import sdhci_reg_pkg::*;
 `include "common_cells/registers.svh"
 `include "defines.svh"
 
-module autocmd_wrap (
+module autocmd_wrap #(
+  parameter int unsigned CmdQueueDepth = 4 // commands the driver can queue up
+) (
   input  logic clk_i,
   input  logic rst_ni,
   input  logic clk_en_p_i, // high before next sd_clk posedge
@@ -32,6 +34,7 @@ module autocmd_wrap (
   output logic cmd_needs_busy_o,
   output logic cmd_data_present_o,
   output logic cmd_transfer_direction_o,
+  output logic cmd_suspend_o, // a driver command of type suspend or abort just started
 
   output logic [31:0] response0_d_o,
   output logic [31:0] response1_d_o,
@@ -43,6 +46,7 @@ module autocmd_wrap (
   output logic response3_de_o,
 
   output `writable_reg_t() command_inhibit_cmd_o,
+  output logic [7:0] cmd_queue_free_entries_o,
   output `writable_reg_t() command_end_bit_error_o,
   output `writable_reg_t() command_crc_error_o,
   output `writable_reg_t() command_index_error_o,
@@ -50,12 +54,75 @@ module autocmd_wrap (
 
   output sdhci_reg_pkg::sdhci_hw2reg_auto_cmd12_error_status_reg_t auto_cmd12_errors_o
 );
+  ///////////////////
+  // Command Queue //
+  ///////////////////
+
+  // Everything needed to issue a driver command. Block size, count and
+  // transfer mode are not part of an entry, they are guarded by the DAT
+  // inhibit and stay fixed until the data transfer is done.
+  typedef struct packed {
+    sdhci_pkg::cmd_t           index;
+    sdhci_pkg::cmd_arg_t       argument;
+    sdhci_pkg::response_type_e response_type;
+    logic                      crc_check;
+    logic                      index_check;
+    logic                      data_present;
+    logic                      suspend;
+  } cmd_entry_t;
+
+  // The command register q is valid one cycle after qe
+  logic cmd_push_q;
+  `FF(cmd_push_q, reg2hw.command.command_index.qe, '0, clk_i, rst_ni);
+
+  cmd_entry_t cmd_queue_in, cmd_queue_head;
+  assign cmd_queue_in = '{
+    index:         reg2hw.command.command_index.q,
+    argument:      reg2hw.argument.q,
+    response_type: sdhci_pkg::response_type_e'(reg2hw.command.response_type_select.q),
+    crc_check:     reg2hw.command.command_crc_check_enable.q,
+    index_check:   reg2hw.command.command_index_check_enable.q,
+    data_present:  reg2hw.command.data_present_select.q,
+    suspend:       reg2hw.command.command_type.q inside {2'b01, 2'b11}
+  };
+
+  localparam int unsigned CmdQueueAddrWidth = (CmdQueueDepth > 1) ? $clog2(CmdQueueDepth) : 1;
+
+  logic cmd_queue_full, cmd_queue_empty, cmd_queue_pop, cmd_queue_flush;
+  logic [CmdQueueAddrWidth-1:0] cmd_queue_usage;
+
+  fifo_v3 #(
+    .DEPTH      (CmdQueueDepth),
+    .dtype      (cmd_entry_t)
+  ) i_cmd_queue (
+    .clk_i      (clk_i),
+    .rst_ni     (rst_ni),
+    .flush_i    (cmd_queue_flush),
+    .testmode_i (1'b0),
+    .full_o     (cmd_queue_full),
+    .empty_o    (cmd_queue_empty),
+    .usage_o    (cmd_queue_usage),
+    .data_i     (cmd_queue_in),
+    .push_i     (cmd_push_q && !cmd_queue_full), // writes to a full queue are dropped
+    .data_o     (cmd_queue_head),
+    .pop_i      (cmd_queue_pop)
+  );
+
+  // usage wraps to zero when the queue is full. A command written in the
+  // previous cycle is already counted, so the driver never sees a stale slot.
+  always_comb begin
+    cmd_queue_free_entries_o = '0;
+    if (!cmd_queue_full) begin
+      cmd_queue_free_entries_o = 8'(CmdQueueDepth - cmd_queue_usage - cmd_push_q);
+    end
+  end
+
   ////////////////
   // Main Logic //
   ////////////////
 
-  logic driver_cmd_queued_q, driver_cmd_queued_d;
-  `FF(driver_cmd_queued_q, driver_cmd_queued_d, '0, clk_i, rst_ni);
+  logic driver_cmd_queued;
+  assign driver_cmd_queued = !cmd_queue_empty;
 
   logic autocmd12_queued_q, autocmd12_queued_d;
   `FF(autocmd12_queued_q, autocmd12_queued_d, '0, clk_i, rst_ni);
@@ -63,13 +130,30 @@ module autocmd_wrap (
   logic running_autocmd12_q, running_autocmd12_d;
   `FF(running_autocmd12_q, running_autocmd12_d, '0, clk_i, rst_ni);
 
+  // Auto CMD23 goes out right before a multi block data command, with
+  // argument 2 (shared with the SDMA system address) as its argument
+  logic autocmd23_sent_q, autocmd23_sent_d;
+  `FF(autocmd23_sent_q, autocmd23_sent_d, '0, clk_i, rst_ni);
+
+  logic running_autocmd23_q, running_autocmd23_d;
+  `FF(running_autocmd23_q, running_autocmd23_d, '0, clk_i, rst_ni);
+
+  logic issue_autocmd23;
+  assign issue_autocmd23 = driver_cmd_queued && !autocmd12_queued_q && !autocmd23_sent_q &&
+                           cmd_queue_head.data_present &&
+                           reg2hw.transfer_mode.auto_cmd23_enable.q &&
+                           reg2hw.transfer_mode.multi_single_block_select.q;
+
+  logic running_autocmd;
+  assign running_autocmd = running_autocmd12_q || running_autocmd23_q;
+
   logic command_queued;
-  assign command_queued = driver_cmd_queued_q || autocmd12_queued_q;
+  assign command_queued = driver_cmd_queued || autocmd12_queued_q;
 
   always_comb begin
-    cmd_data_present_o = reg2hw.command.data_present_select.q;
+    cmd_data_present_o = cmd_queue_head.data_present;
 
-    if (autocmd12_queued_q) begin
+    if (autocmd12_queued_q || issue_autocmd23) begin
       cmd_data_present_o = 1'b0;
     end
   end
@@ -79,26 +163,28 @@ module autocmd_wrap (
   logic command_started;
   assign command_started = command_queued & command_ready;
   assign cmd_started_o   = command_started;
+  assign cmd_suspend_o   = command_started && !autocmd12_queued_q && !issue_autocmd23 &&
+                           cmd_queue_head.suspend;
 
   logic end_bit_error;
   logic crc_error;
   logic index_error;
   logic timeout_error;
 
-  logic cmd_errors_occured;
-  assign cmd_errors_occured = end_bit_error || crc_error || index_error || timeout_error;
-
   sdhci_pkg::cmd_t current_cmd;
   assign current_cmd = autocmd12_queued_q ? 6'd12 :
-                       reg2hw.command.command_index.q;
+                       issue_autocmd23    ? 6'd23 :
+                       cmd_queue_head.index;
 
   sdhci_pkg::cmd_arg_t current_arg;
-  assign current_arg = autocmd12_queued_q ? '0 : reg2hw.argument.q;
+  assign current_arg = autocmd12_queued_q ? '0 :
+                       issue_autocmd23    ? reg2hw.system_address.q :
+                       cmd_queue_head.argument;
 
   sdhci_pkg::response_type_e current_rsp_type;
 
   always_comb begin : rsp_type
-    current_rsp_type = sdhci_pkg::response_type_e'(reg2hw.command.response_type_select.q);
+    current_rsp_type = cmd_queue_head.response_type;
 
     // according to electrical spec 7.8.4, CMD12 is R1 on reads and R1b on writes
     if (autocmd12_queued_q) begin
@@ -109,22 +195,39 @@ module autocmd_wrap (
         // read -> R1
         current_rsp_type = sdhci_pkg::RESPONSE_LENGTH_48;
       end
+    end else if (issue_autocmd23) begin
+      // CMD23 is R1
+      current_rsp_type = sdhci_pkg::RESPONSE_LENGTH_48;
     end
   end
 
   assign cmd_needs_busy_o = current_rsp_type == sdhci_pkg::RESPONSE_LENGTH_48_CHECK_BUSY;
+
+  // The queue head moves on as soon as a command starts, so keep what the
+  // response mapping and error checks need for the one on the bus
+  sdhci_pkg::response_type_e running_rsp_type_q;
+  `FFL(running_rsp_type_q, current_rsp_type, command_started, sdhci_pkg::NO_RESPONSE, clk_i, rst_ni);
+
+  logic running_crc_check_q, running_index_check_q;
+  `FFL(running_crc_check_q, autocmd12_queued_q || issue_autocmd23 || cmd_queue_head.crc_check,
+       command_started, '0, clk_i, rst_ni);
+  `FFL(running_index_check_q, autocmd12_queued_q || issue_autocmd23 || cmd_queue_head.index_check,
+       command_started, '0, clk_i, rst_ni);
+
+  logic cmd_failed;
+  assign cmd_failed = (cmd_result_valid && (end_bit_error || (crc_error && running_crc_check_q) ||
+                                            (index_error && running_index_check_q))) || timeout_error;
   assign cmd_transfer_direction_o = reg2hw.transfer_mode.data_transfer_direction_select.q;
 
   always_comb begin : request_commands
-    driver_cmd_queued_d = driver_cmd_queued_q;
+    cmd_queue_pop   = 1'b0;
+    cmd_queue_flush = 1'b0;
     autocmd12_queued_d = autocmd12_queued_q;
     auto_cmd12_errors_o.command_not_issued_by_auto_cmd12_error.de = 1'b0;
     auto_cmd12_errors_o.auto_cmd12_not_executed.de = 1'b0;
     running_autocmd12_d = running_autocmd12_q;
-
-    if (reg2hw.command.command_index.qe) begin
-      driver_cmd_queued_d = 1'b1;
-    end
+    running_autocmd23_d = running_autocmd23_q;
+    autocmd23_sent_d    = autocmd23_sent_q;
 
     if (request_cmd12_i) begin
       autocmd12_queued_d = 1'b1;
@@ -133,23 +236,29 @@ module autocmd_wrap (
     if (command_started) begin
       // A command has just been submitted
       running_autocmd12_d = autocmd12_queued_q;
+      running_autocmd23_d = !autocmd12_queued_q && issue_autocmd23;
       if (autocmd12_queued_q) begin
         // autocmd12 has priority
         autocmd12_queued_d = 1'b0;
+      end else if (issue_autocmd23) begin
+        autocmd23_sent_d = 1'b1;
       end else begin
-        driver_cmd_queued_d = 1'b0;
+        cmd_queue_pop    = 1'b1;
+        autocmd23_sent_d = 1'b0;
       end
     end
 
-    if ((cmd_result_valid && cmd_errors_occured) || timeout_error) begin
+    if (cmd_failed) begin
       // This should never race with command submission,
       // as there is a period of time where the cmd line needs
       // to stay idle (per spec). Errors are reported during
-      // that time
-      driver_cmd_queued_d = 1'b0;
-      autocmd12_queued_d  = 1'b0;
+      // that time. Whatever the driver queued after the failing
+      // command is dropped.
+      cmd_queue_flush    = 1'b1;
+      autocmd12_queued_d = 1'b0;
+      autocmd23_sent_d   = 1'b0;
 
-      if (running_autocmd12_q && driver_cmd_queued_q) begin
+      if (running_autocmd12_q && driver_cmd_queued) begin
         // We aborted driver command
         auto_cmd12_errors_o.command_not_issued_by_auto_cmd12_error.de = 1'b1;
       end
@@ -169,8 +278,10 @@ module autocmd_wrap (
   logic cmd_inhibit_logic;
 
   assign command_inhibit_cmd_o.de = '1;
-  // autocmd12 execution should not inhibit the driver
-  assign command_inhibit_cmd_o.d  = driver_cmd_queued_q | (cmd_inhibit_logic && ~running_autocmd12_q);
+  // autocmd12 execution should not inhibit the driver. Queued commands keep
+  // the inhibit set, so command complete fires once the whole queue is done.
+  assign command_inhibit_cmd_o.d  = cmd_push_q | driver_cmd_queued |
+                                    (cmd_inhibit_logic && ~running_autocmd12_q);
 
   logic [31:0] rsp0, rsp1, rsp2, rsp3;
   logic [119:0] rsp;
@@ -181,11 +292,11 @@ module autocmd_wrap (
     rsp2 = reg2hw.response2.q;
     rsp3 = reg2hw.response3.q;
 
-    if (running_autocmd12_q) begin
-      // auto cmd 12 response goes to upper word of rsp register
+    if (running_autocmd) begin
+      // auto cmd 12/23 response goes to upper word of rsp register
       rsp3 = rsp [31:0];
     end else begin
-      unique case (current_rsp_type)
+      unique case (running_rsp_type_q)
         sdhci_pkg::NO_RESPONSE:;
 
         sdhci_pkg::RESPONSE_LENGTH_136: begin
@@ -222,8 +333,8 @@ module autocmd_wrap (
   logic check_end_bit_err, check_crc_err, check_index_err, check_timeout_error;
 
   assign check_end_bit_err   = reg2hw.error_interrupt_status_enable.command_end_bit_error_status_enable.q;
-  assign check_crc_err       = reg2hw.error_interrupt_status_enable.command_crc_error_status_enable.q & reg2hw.command.command_crc_check_enable.q;
-  assign check_index_err     = reg2hw.error_interrupt_status_enable.command_index_error_status_enable.q & reg2hw.command.command_index_check_enable.q;
+  assign check_crc_err       = reg2hw.error_interrupt_status_enable.command_crc_error_status_enable.q & running_crc_check_q;
+  assign check_index_err     = reg2hw.error_interrupt_status_enable.command_index_error_status_enable.q & running_index_check_q;
   assign check_timeout_error = reg2hw.error_interrupt_status_enable.command_timeout_error_status_enable.q;
 
   // Only set error interrupt status, software should clear it
@@ -240,8 +351,9 @@ module autocmd_wrap (
   assign auto_cmd12_errors_o.command_not_issued_by_auto_cmd12_error.d = 1'b1;
 
   // Timeout is not handshaked, so directly pass it through
-  assign command_timeout_error_o.de                      = running_autocmd12_q ? 1'b0 : check_timeout_error & timeout_error;
-  assign auto_cmd12_errors_o.auto_cmd12_timeout_error.de = running_autocmd12_q ? timeout_error : 1'b0;
+  // Auto CMD23 errors are reported like Auto CMD12 ones
+  assign command_timeout_error_o.de                      = running_autocmd ? 1'b0 : check_timeout_error & timeout_error;
+  assign auto_cmd12_errors_o.auto_cmd12_timeout_error.de = running_autocmd ? timeout_error : 1'b0;
 
   always_comb begin : cmd_seq_ctrl
     command_end_bit_error_o.de = 1'b0;
@@ -253,7 +365,7 @@ module autocmd_wrap (
     auto_cmd12_errors_o.auto_cmd12_crc_error.de     = 1'b0;
 
     if (cmd_result_valid) begin
-      if (running_autocmd12_q) begin
+      if (running_autocmd) begin
         auto_cmd12_errors_o.auto_cmd12_end_bit_error.de = end_bit_error;
         auto_cmd12_errors_o.auto_cmd12_crc_error.de     = crc_error;
         auto_cmd12_errors_o.auto_cmd12_index_error.de   = index_error;
@@ -275,6 +387,7 @@ module autocmd_wrap (
     .clk_en_p_i        (clk_en_p_i),
     .clk_en_n_i        (clk_en_n_i),
     .div_1_i           (div_1_i),
+    .high_speed_i      (reg2hw.host_control.high_speed_enable.q),
     .sd_bus_cmd_i      (sd_bus_cmd_i),
     .sd_bus_cmd_o      (sd_bus_cmd_o),
     .sd_bus_cmd_en_o   (sd_bus_cmd_en_o),
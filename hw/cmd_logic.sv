@@ -13,6 +13,7 @@ module cmd_logic (
   input  logic clk_en_p_i,
   input  logic clk_en_n_i,
   input  logic div_1_i,
+  input  logic high_speed_i,
 
   input  logic sd_bus_cmd_i,
   output logic sd_bus_cmd_o,
@@ -50,10 +51,11 @@ module cmd_logic (
   cmd_fsm_t cmd_state_q, cmd_state_d;
   `FF(cmd_state_q, cmd_state_d, IDLE, clk_i, rst_ni);
 
-  // TODO: this forces a sleep cycle in between transactions. This might not
-  // be ideal -> reduce sleep cycles in BUS_COOLDOWN by one
+  // A queued command can start right when the cooldown is over, so back to
+  // back commands are spaced by exactly N_CC / N_RC
+  logic cooldown_done;
   logic cmd_ready;
-  assign cmd_ready = cmd_state_q == IDLE;
+  assign cmd_ready = cmd_state_q == IDLE || cooldown_done;
 
   logic start_cmd;
   assign start_cmd = cmd_ready && cmd_valid_i;
@@ -84,6 +86,9 @@ module cmd_logic (
   logic clear_cycle_counter;
   logic [6:0] cycles_waiting;
 
+  assign cooldown_done = cmd_state_q == BUS_COOLDOWN &&
+                         cycles_waiting == (response_type_q == sdhci_pkg::NO_RESPONSE ? N_CC : N_RC);
+
   assign clear_cycle_counter = (cmd_state_d == WAIT_RSP && cmd_state_q != WAIT_RSP) ||
                                (cmd_state_d == BUS_COOLDOWN && cmd_state_q != BUS_COOLDOWN);
 
@@ -133,11 +138,8 @@ module cmd_logic (
         end
       end
       BUS_COOLDOWN: begin
-        if (response_type_q == sdhci_pkg::NO_RESPONSE
-            && cycles_waiting == N_CC) begin
-          cmd_state_d = IDLE;
-        end else if (cycles_waiting == N_RC) begin
-          cmd_state_d = IDLE;
+        if (cooldown_done) begin
+          cmd_state_d = start_cmd ? START : IDLE;
         end
       end
       RSP_TIMEOUT: begin
@@ -199,6 +201,7 @@ module cmd_logic (
     .clk_en_p_i     (clk_en_p_i),
     .clk_en_n_i     (clk_en_n_i),
     .div_1_i        (div_1_i),
+    .high_speed_i   (high_speed_i),
 
     .cmd_o          (sd_bus_cmd_o),
     .cmd_en_o       (sd_bus_cmd_en_o),
@@ -16,6 +16,7 @@ module cmd_write (
   input   logic         clk_en_p_i,
   input   logic         clk_en_n_i,
   input   logic         div_1_i,        // is SD CLK frequency same as clk_i frequency?
+  input   logic         high_speed_i,   // launch after the rising edge of SD CLK
 
   output  logic         cmd_o,          // to sd cmd line
   output  logic         cmd_en_o,       // for tri-state driver
@@ -91,7 +92,7 @@ module cmd_write (
   assign cmd_bits_47_to_8 [37:32] = cmd_nr_i;
   assign cmd_bits_47_to_8 [31:0]  = cmd_argument_i;
 
-  logic par_write_en, shift_en, crc7_shift_en, shift_reg_out, crc7_out, sd_cmd, sd_cmd_div1, sd_cmd_divn; // control signals
+  logic par_write_en, shift_en, crc7_shift_en, shift_reg_out, crc7_out, sd_cmd, sd_cmd_div1, sd_cmd_divn, sd_cmd_hs; // control signals
   logic tx_ongoing_d, tx_ongoing_q; // if transmission is ongoing
 
 
@@ -151,9 +152,15 @@ module cmd_write (
   // delay to negative edge of sd_clk
   `FFL(sd_cmd_divn, sd_cmd, clk_en_n_i, '1, clk_i, rst_ni);
 
+  // high speed: delay to one clk cycle after the positive edge of sd_clk
+  logic clk_en_p_q;
+  `FF(clk_en_p_q, clk_en_p_i, 1'b0, clk_i, rst_ni);
+  `FFL(sd_cmd_hs, sd_cmd, clk_en_p_q, '1, clk_i, rst_ni);
+
   // if freq of sd_clk and clk is same, delay to negative edge of clk
-  // otherwise delay to negative edge of sd_clk
-  assign cmd_o = (div_1_i)  ? sd_cmd_div1 : sd_cmd_divn;
+  // otherwise delay to negative edge of sd_clk, or past the positive edge in high speed mode
+  assign cmd_o = (div_1_i)      ? sd_cmd_div1 :
+                 (high_speed_i) ? sd_cmd_hs   : sd_cmd_divn;
 
   ///////////////////////////
   // Module Instantiations //
@@ -6,13 +6,30 @@
 // - Micha Wehrli <miwehrli@student.ethz.ch>
 // - Anton Buchner <abuchner@student.ethz.ch>
 
+/**
+ * Data buffer between the sd side and the host side
+ * The sd side and the buffer_data_port move 32 bit words, the buffer data window moves whole
+ * `DataWidth` words. Narrow accesses are packed into / unpacked from buffer words, every block
+ * starts at a new buffer word so a partial last word is padded.
+ * Window and buffer_data_port accesses may be mixed inside a block as long as the window is only
+ * accessed at the start of a buffer word.
+ * With write_prefill the host may fill the buffer for a PIO write before the command is issued.
+ * The buffer stays open until the write ends, it is emptied for a cycle after that.
+ * With cut_through_words the sd side may start a write block before all of it was written, it
+ * then has to be told if a word it asks for is missing.
+ * The read and write watermarks let PIO move a block in parts, the buffer enables are then set
+ * as soon as that many words of the current block can be moved.
+ */
+
 `include "common_cells/registers.svh"
 `include "common_cells/assertions.svh"
 `include "defines.svh"
 
 module dat_buffer #(
-  parameter int unsigned NumWords        = 256,
-  parameter int unsigned MaxBlockBitSize = 10
+  parameter int unsigned NumWords        = 256, // DataWidth bit words
+  parameter int unsigned DataWidth       = 32,  // 32 or 64
+  parameter int unsigned MaxBlockBitSize = 10,
+  parameter bit          DualPort        = 1'b0  // see sram_shift_reg
 ) (
   input  logic clk_i,
   input  logic rst_ni,
@@ -23,6 +40,7 @@ module dat_buffer #(
   input  logic        read_ready_i,
   output logic        read_valid_o,
   output logic [31:0] read_data_o,
+  output logic        read_underrun_o, // read_ready_i with the next word of the block missing
 
   input  logic        write_valid_i,
   input  logic [31:0] write_data_i,
@@ -30,98 +48,235 @@ module dat_buffer #(
 
   output logic        empty_o,
 
+  // Host side access by the dma engine, replaces buffer_data_port accesses if dma_enable is set
+  input  logic        dma_pop_i,
+  input  logic        dma_push_i,
+  input  logic [31:0] dma_push_data_i,
+
+  // Host side access through the buffer data window, ignored if dma_enable is set
+  input  logic                 window_pop_i,
+  input  logic                 window_push_i,
+  input  logic [DataWidth-1:0] window_push_data_i,
+  output logic [DataWidth-1:0] window_pop_data_o,
+
   input  sdhci_reg_pkg::sdhci_reg2hw_t reg2hw_i,
 
   output logic [31:0]      buffer_data_port_d_o,
   output `writable_reg_t() buffer_read_enable_o,
   output `writable_reg_t() buffer_write_enable_o,
 
-  output `writable_reg_t([15:0]) block_count_o
+  output `writable_reg_t([15:0]) block_count_o,
+  // Blocks the host has written since the buffer was opened for the current write
+  output logic [15:0]            host_blocks_o
 );
-  localparam int NumBytes = NumWords * 4;
+  localparam int unsigned NumLanes     = DataWidth / 32;
+  localparam int unsigned LaneWidth    = cf_math_pkg::idx_width(NumLanes);
+  localparam int unsigned BytesPerWord = DataWidth / 8;
 
-  logic [MaxBlockBitSize-1:0] block_size;
-  assign block_size = MaxBlockBitSize'(reg2hw_i.block_size.transfer_block_size.q);
+  `ASSERT_INIT(DataWidthLanes, DataWidth == 32 || DataWidth == 64);
 
+  logic [MaxBlockBitSize-1:0] block_size, block_lanes, block_words;
+  assign block_size  = MaxBlockBitSize'(reg2hw_i.block_size.transfer_block_size.q);
+  assign block_lanes = MaxBlockBitSize'((block_size + 3) / 4);
+  assign block_words = MaxBlockBitSize'((block_size + BytesPerWord - 1) / BytesPerWord);
+
+  // Position inside the current block in 32 bit words
   logic [MaxBlockBitSize-1:0] current_word_counter_q, current_word_counter_d;
+  logic [MaxBlockBitSize-1:0] sd_word_counter_q, sd_word_counter_d;
   `FF (current_word_counter_q, current_word_counter_d, '0);
+  `FF (sd_word_counter_q, sd_word_counter_d, '0);
+
+  logic [LaneWidth-1:0] host_lane, sd_lane;
+  assign host_lane = LaneWidth'(current_word_counter_q % NumLanes);
+  assign sd_lane   = LaneWidth'(sd_word_counter_q % NumLanes);
+
+  logic host_last_lane, sd_last_lane;
+  assign host_last_lane = host_lane == LaneWidth'(NumLanes - 1) || current_word_counter_q == block_lanes - 1;
+  assign sd_last_lane   = sd_lane == LaneWidth'(NumLanes - 1) || sd_word_counter_q == block_lanes - 1;
+
+  // Narrow words of the buffer word that is currently being filled
+  logic [DataWidth-1:0] pack_q, pack_d;
+  `FF (pack_q, pack_d, '0);
 
   logic reg_empty;
   assign empty_o = reg_empty;
 
   logic [cf_math_pkg::idx_width(NumWords + 1)-1:0] reg_length;
-  logic [cf_math_pkg::idx_width(NumBytes + 1)-1:0] reg_remaining_bytes;
-  assign reg_remaining_bytes = (cf_math_pkg::idx_width(NumBytes + 1))'(NumBytes - reg_length * 4);
 
   logic has_block, has_space;
-  assign has_space = reg_remaining_bytes >= block_size;
-  assign has_block = reg_length * 4 >= block_size;
+  assign has_space = NumWords - reg_length >= block_words;
+  assign has_block = reg_length >= block_words;
+
+  // 32 bit words the sd side has not read yet, a padded last word counts its padding
+  logic [cf_math_pkg::idx_width(NumWords + 1)+LaneWidth-1:0] sd_words;
+  assign sd_words = reg_length * NumLanes - sd_lane;
+
+  logic [7:0] cut_through_words;
+  assign cut_through_words = reg2hw_i.buffer_control.cut_through_words.q;
+
+  logic can_start;
+  assign can_start = has_block || (cut_through_words != '0 && sd_words >= cut_through_words);
+
+  // Same for the host side, the words it already packed take up part of the next buffer word
+  logic [cf_math_pkg::idx_width(NumWords + 1)+LaneWidth-1:0] host_words, host_free;
+  assign host_words = reg_length * NumLanes - host_lane;
+  assign host_free  = (NumWords - reg_length) * NumLanes - host_lane;
+
+  logic [MaxBlockBitSize-1:0] host_left;
+  assign host_left = block_lanes - current_word_counter_q;
+
+  logic [7:0] read_watermark, write_watermark;
+  assign read_watermark  = reg2hw_i.transfer_mode.dma_enable.q ? '0 :
+                           reg2hw_i.buffer_control.read_watermark.q;
+  assign write_watermark = reg2hw_i.transfer_mode.dma_enable.q ? '0 :
+                           reg2hw_i.buffer_control.write_watermark.q;
+
+  logic can_read, can_write;
+  assign can_read  = has_block || (read_watermark != '0 &&
+                     (host_words >= read_watermark || host_words >= host_left));
+  assign can_write = has_space || (write_watermark != '0 &&
+                     (host_free >= write_watermark || host_free >= host_left));
+
+  logic write_operation_q;
+  `FF (write_operation_q, write_operation_i, '0);
+
+  logic prefill;
+  assign prefill = reg2hw_i.buffer_control.write_prefill.q &&
+                   !reg2hw_i.transfer_mode.data_transfer_direction_select.q &&
+                   !reg2hw_i.transfer_mode.dma_enable.q && !read_operation_i && !write_operation_q;
+
+  logic write_side;
+  assign write_side = write_operation_i || prefill;
 
   logic enable_reg;
-  assign enable_reg = read_operation_i || write_operation_i;
+  assign enable_reg = read_operation_i || write_side;
+
+  logic [15:0] host_blocks_q, host_blocks_d;
+  `FF (host_blocks_q, host_blocks_d, '0);
+  assign host_blocks_o = host_blocks_q;
 
   logic reg_full, reg_push, reg_pop;
-  logic [31:0] reg_push_data, reg_pop_data;
+  logic [DataWidth-1:0] reg_push_data, reg_pop_data;
+
+  logic host_pop, host_push, host_wide;
+  logic [31:0] host_push_data;
+  always_comb begin : host_access
+    host_wide = '0;
+    if (reg2hw_i.transfer_mode.dma_enable.q) begin
+      host_pop       = dma_pop_i;
+      host_push      = dma_push_i;
+      host_push_data = dma_push_data_i;
+    end else begin
+      host_pop       = reg2hw_i.buffer_data_port.re || window_pop_i;
+      host_push      = reg2hw_i.buffer_data_port.qe || window_push_i;
+      host_push_data = reg2hw_i.buffer_data_port.q;
+      host_wide      = window_pop_i || window_push_i;
+    end
+  end
 
   always_comb begin
     reg_push      = '0;
     reg_push_data = 'X;
     reg_pop       = '0;
+    pack_d        = pack_q;
 
     buffer_read_enable_o  = '{ de: '1, d: '0 };
     buffer_write_enable_o = '{ de: '1, d: '0 };
     buffer_data_port_d_o  = '0;
+    window_pop_data_o     = '0;
 
     block_count_o = '{ de: '0, d: 'X };
 
-    write_ready_o = '0;
-    read_valid_o  = '0;
-    read_data_o   = 'X;
+    write_ready_o   = '0;
+    read_valid_o    = '0;
+    read_data_o     = 'X;
+    read_underrun_o = '0;
 
     if (read_operation_i) begin
-      reg_push      = write_valid_i;
-      reg_push_data = write_data_i;
       write_ready_o = has_space;
+      if (write_valid_i) begin
+        pack_d[sd_lane*32 +: 32] = write_data_i;
+        reg_push      = sd_last_lane;
+        reg_push_data = pack_d;
+      end
+
+      buffer_read_enable_o.d = can_read;
+      buffer_data_port_d_o   = reg_pop_data[host_lane*32 +: 32];
+      window_pop_data_o      = reg_pop_data;
+      reg_pop                = host_pop && (host_wide || host_last_lane);
+    end else if (write_side) begin
+      reg_pop      = read_ready_i && sd_last_lane;
+      read_data_o  = reg_pop_data[sd_lane*32 +: 32];
+      read_valid_o = can_start;
 
-      buffer_read_enable_o.d = has_block;
-      buffer_data_port_d_o   = reg_pop_data;
-      reg_pop                = reg2hw_i.buffer_data_port.re;
-    end else if (write_operation_i) begin
-      reg_pop      = read_ready_i;
-      read_data_o  = reg_pop_data;
-      read_valid_o = has_block;
-
-      buffer_write_enable_o.d = has_space; 
-      reg_push_data           = reg2hw_i.buffer_data_port.q;
-      reg_push                = reg2hw_i.buffer_data_port.qe;
+      // Looks one word ahead on purpose: dat_write only takes the next word from read_data_o up to
+      // a word time after this pop, and whether the host gets it in by then is not known here.
+      // So besides the word being popped, the next one of the block has to be buffered already,
+      // a host that keeps one word ahead of the card never underruns.
+      read_underrun_o = read_ready_i && sd_word_counter_q != block_lanes - 1 && sd_words < 2;
+
+      buffer_write_enable_o.d = can_write;
+      if (host_push && host_wide) begin
+        reg_push      = '1;
+        reg_push_data = window_push_data_i;
+      end else if (host_push) begin
+        pack_d[host_lane*32 +: 32] = host_push_data;
+        reg_push      = host_last_lane;
+        reg_push_data = pack_d;
+      end
+    end
+
+
+    sd_word_counter_d = sd_word_counter_q;
+
+    if ((read_operation_i && write_valid_i) || (write_operation_i && read_ready_i)) begin
+      if (sd_word_counter_q == block_lanes - 1) begin
+        sd_word_counter_d = '0;
+      end else begin
+        sd_word_counter_d = sd_word_counter_q + 1;
+      end
     end
 
 
     current_word_counter_d = current_word_counter_q;
+    host_blocks_d          = host_blocks_q;
 
-    if ((read_operation_i && reg2hw_i.buffer_data_port.re) || (write_operation_i && reg2hw_i.buffer_data_port.qe)) begin
-      if (current_word_counter_q == (block_size + 3) / 4 - 1) begin
+    if ((read_operation_i && host_pop) || (write_side && host_push)) begin
+      if (current_word_counter_q + (host_wide ? NumLanes : 1) >= block_lanes) begin
         current_word_counter_d = '0;
+        if (write_side) begin
+          host_blocks_d = host_blocks_q + 1;
+        end
 
-        // TODO block count enable / infity block transfer
         if (reg2hw_i.transfer_mode.multi_single_block_select.q) begin
-          // TODO this will have to be changed when adding support for suspend / resume
-          block_count_o = '{ de: '1, d: reg2hw_i.block_count.q - 1 };
-          if (reg2hw_i.block_count.q != 'b1) begin
+          // Without block count enable the transfer is open ended and the count is left alone.
+          // A suspended write overrides this in dat_wrap, the card is behind the host there
+          if (reg2hw_i.transfer_mode.block_count_enable.q) begin
+            block_count_o = '{ de: '1, d: reg2hw_i.block_count.q - 1 };
+          end
+          if (!reg2hw_i.transfer_mode.block_count_enable.q || reg2hw_i.block_count.q != 'b1) begin
             // To trigger an interrupt
             buffer_write_enable_o.d = '0;
             buffer_read_enable_o.d  = '0;
           end
         end
       end else begin
-        current_word_counter_d = current_word_counter_q + 1;
+        current_word_counter_d = current_word_counter_q + (host_wide ? NumLanes : 1);
       end
     end
+
+    if (!enable_reg) begin
+      sd_word_counter_d      = '0;
+      current_word_counter_d = '0;
+      host_blocks_d          = '0;
+    end
   end
 
 
   sram_shift_reg #(
-    .NumWords (NumWords)
+    .NumWords  (NumWords),
+    .DataWidth (DataWidth),
+    .DualPort  (DualPort)
   ) i_sram_shift_reg (
     .clk_i,
     .rst_ni,
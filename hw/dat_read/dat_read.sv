@@ -8,20 +8,26 @@
 `include "common_cells/registers.svh"
 
 // done_o and data_valid_o can be done at the same time
-// theres always atleast 7 cycles between every data_valid_o
+// theres always atleast 7 cycles between every data_valid_o (3 cycles with an 8 bit bus)
+// In DDR mode data and CRC are sampled on both edges, with a separate CRC16 per edge.
+// The start and end bits stay on the rising edge, so the falling edge inside
+// the start bit cycle is skipped. DDR needs a divided sd clock.
 
 module dat_read #(
   parameter int MaxBlockBitSize = 10
 ) (
   input  logic       clk_i,
   input  logic       sd_clk_en_i,
+  input  logic       sd_clk_en_n_i,
   input  logic       rst_ni,
-  input  logic [3:0] dat_i,
+  input  logic [7:0] dat_i,
 
   input  logic                       start_i,
   input  logic                       timeout_i,
   input  logic [MaxBlockBitSize-1:0] block_size_i, // In bytes
   input  logic                       bus_width_is_4_i,
+  input  logic                       bus_width_is_8_i, // Takes precedence over bus_width_is_4_i
+  input  logic                       ddr_i,
 
   output logic        data_valid_o,
   output logic [31:0] data_o,
@@ -31,7 +37,7 @@ module dat_read #(
   output logic crc_err_o,     // Only valid while done_o = 1
   output logic end_bit_err_o  // Only valid while done_o = 1
 );
-  // Need space for block_size_i * 8 + 16
+  // Need space for block_size_i * 8 + 32
   localparam int CounterWidth = MaxBlockBitSize + 4;
 
   typedef enum logic [2:0] {
@@ -46,10 +52,24 @@ module dat_read #(
   `FF (state_q, state_d, IDLE);
 
   logic [CounterWidth-1:0] counter_q, counter_d;
-  `FFL (counter_q, counter_d, sd_clk_en_i, 0);
+
+  // Counter and data buildup step once per sampled edge
+  logic sd_clk_en_n_ddr, sd_clk_en_any;
+  assign sd_clk_en_n_ddr = ddr_i && sd_clk_en_n_i && (state_q inside {DAT, CRC}) && counter_q != '0;
+  assign sd_clk_en_any   = sd_clk_en_i || sd_clk_en_n_ddr;
+
+  `FFL (counter_q, counter_d, sd_clk_en_any, 0);
+
+  logic [CounterWidth-1:0] crc_clock_count;
+  assign crc_clock_count = ddr_i ? 32 : 16;
 
   logic [CounterWidth-1:0] required_clock_count;
-  assign required_clock_count = bus_width_is_4_i ? 2*block_size_i : 8*block_size_i;
+  assign required_clock_count = bus_width_is_8_i ?   block_size_i :
+                                bus_width_is_4_i ? 2*block_size_i : 8*block_size_i;
+
+  logic start_bit;
+  assign start_bit = bus_width_is_8_i ? dat_i      == 8'b0 :
+                     bus_width_is_4_i ? dat_i[3:0] == 4'b0 : dat_i[0] == 1'b0;
 
   always_comb begin
     state_d = state_q;
@@ -61,7 +81,7 @@ module dat_read #(
         end
       end
       READY: begin
-        if ((bus_width_is_4_i ? dat_i == 4'b0 : dat_i[0] == 1'b0) && sd_clk_en_i) begin
+        if (start_bit && sd_clk_en_i) begin
           state_d = DAT;
         end
         if (timeout_i) begin
@@ -69,12 +89,12 @@ module dat_read #(
         end
       end
       DAT: begin
-        if ((counter_q + 1 == required_clock_count) && sd_clk_en_i) begin
+        if ((counter_q + 1 == required_clock_count) && sd_clk_en_any) begin
           state_d = CRC;
         end
       end
       CRC: begin
-        if ((counter_q + 1 == required_clock_count + 16) && sd_clk_en_i) begin
+        if ((counter_q + 1 == required_clock_count + crc_clock_count) && sd_clk_en_any) begin
           state_d = END_BIT;
         end
       end
@@ -90,9 +110,9 @@ module dat_read #(
   end
 
   logic calculate_crc;
-  logic [3:0] crc_errors;
+  logic [7:0] crc_errors;
   logic [31:0] data_buildup_q, data_buildup_d;
-  `FFL (data_buildup_q, data_buildup_d, sd_clk_en_i, 0);
+  `FFL (data_buildup_q, data_buildup_d, sd_clk_en_any, 0);
 
   always_comb begin
     counter_d      = '0;
@@ -115,12 +135,23 @@ module dat_read #(
         calculate_crc = '1;
         counter_d = counter_q + 1;
 
-        if (bus_width_is_4_i) begin
+        if (bus_width_is_8_i) begin
+          // Bus width = 8
+          // Every 4 cycles (4 * 8lines = 32) flush buildup
+          // dat 0..7: bit 0..7 of the current byte
+          if (counter_q[1:0] == '1) begin
+            data_valid_o   = sd_clk_en_any;
+            data_o         = { dat_i, data_buildup_q[31:8] };
+            data_buildup_d = '0;
+          end else begin
+            data_buildup_d = { dat_i, data_buildup_q[31:8] };
+          end
+        end else if (bus_width_is_4_i) begin
           // Bus width = 4
           // Every 8 cycles (8 * 4lines = 32) flush buildup
           if (counter_q[2:0] == '1) begin
-            data_valid_o   = sd_clk_en_i;
-            data_o         = { data_buildup_q[31:28], dat_i, data_buildup_q[23:0] };
+            data_valid_o   = sd_clk_en_any;
+            data_o         = { data_buildup_q[31:28], dat_i[3:0], data_buildup_q[23:0] };
             data_buildup_d = '0;
           end else begin
             // dat 0: 4, 0
@@ -129,17 +160,17 @@ module dat_read #(
             // dat 3: 7, 3
             if (counter_q[0] == '0) begin
               // Leave a few empty slots for the next 4 bits
-              data_buildup_d = { dat_i, 4'b0, data_buildup_q[31:8] };
+              data_buildup_d = { dat_i[3:0], 4'b0, data_buildup_q[31:8] };
             end else begin
               // Fill the empty slots
-              data_buildup_d[27:24] = dat_i;
+              data_buildup_d[27:24] = dat_i[3:0];
             end
           end
         end else begin
           // Bus width = 1
           // Every 32 cycles flush buildup
           if (counter_q[4:0] == '1) begin
-            data_valid_o   = sd_clk_en_i;
+            data_valid_o   = sd_clk_en_any;
             data_o         = { data_buildup_q[30:24], dat_i[0], data_buildup_q[23:0] };
             data_buildup_d = '0;
           end else begin
@@ -161,7 +192,7 @@ module dat_read #(
         counter_d     = counter_q + 1;
 
         if (counter_q == required_clock_count && block_size_i[1:0] != 0) begin
-          data_valid_o   = sd_clk_en_i;
+          data_valid_o   = sd_clk_en_any;
           data_buildup_d = '0;
           unique case (block_size_i[1:0])
             2'd0: ;
@@ -173,16 +204,17 @@ module dat_read #(
       end
       END_BIT: begin
         done_o        = sd_clk_en_i;
-        end_bit_err_o = dat_i != '1;
-        crc_err_o     = bus_width_is_4_i ? |(crc_errors) : crc_errors[0];
+        end_bit_err_o = bus_width_is_8_i ? dat_i != '1 : dat_i[3:0] != '1;
+        crc_err_o     = bus_width_is_8_i ? |(crc_errors)      :
+                        bus_width_is_4_i ? |(crc_errors[3:0]) : crc_errors[0];
       end
       default: ;
     endcase
   end
 
-  for (genvar i=0; i<4 ; i++) begin
-    logic [15:0] crc_val;
-    assign crc_errors[i] = crc_val != '0;
+  for (genvar i=0; i<8 ; i++) begin
+    logic [15:0] crc_val, crc_n_val;
+    assign crc_errors[i] = crc_val != '0 || crc_n_val != '0;
 
     crc16_read i_crc16_read (
       .clk_i,
@@ -194,5 +226,17 @@ module dat_read #(
       .dat_ser_i    (dat_i[i]),
       .crc16_o      (crc_val)
     );
+
+    // Falling edge bits in DDR mode, stays cleared otherwise
+    crc16_read i_crc16_read_n (
+      .clk_i,
+      .sd_clk_en_i  (sd_clk_en_n_i),
+      .rst_ni,
+
+      .shift_in_i (calculate_crc && sd_clk_en_n_ddr),
+
+      .dat_ser_i    (dat_i[i]),
+      .crc16_o      (crc_n_val)
+    );
   end
 endmodule
@@ -11,8 +11,11 @@
 
 module dat_wrap #(
   parameter int MaxBlockBitSize = 10, // max_block_length = 512 in caps
-  parameter int unsigned TimeoutDivider = 1 // by how much to divide clk_i to get the timeout count frequency,
-                                            // see dat_timeout for details
+  parameter int unsigned TimeoutDivider = 1, // by how much to divide clk_i to get the timeout count frequency,
+                                             // see dat_timeout for details
+  parameter int unsigned NumBufferBlocks = 2, // 512 byte blocks the data buffer holds, power of two
+  parameter int unsigned DataWidth = 32, // width of the buffer data window, 32 or 64
+  parameter bit DualPortBuffer = 1'b0 // sd side and host side access the buffer in the same cycle
 ) (
   input  logic clk_i,
   input  logic sd_clk_en_p_i,
@@ -20,14 +23,15 @@ module dat_wrap #(
   input  logic div_1_i,
   input  logic rst_ni,
 
-  input  logic [3:0] dat_i,
+  input  logic [7:0] dat_i,
   output logic       dat_en_o,
-  output logic [3:0] dat_o,
+  output logic [7:0] dat_o,
 
   input  logic cmd_started_i,
   input  logic cmd_needs_busy_i,
   input  logic cmd_data_present_i,
   input  logic cmd_transfer_direction_i,
+  input  logic cmd_suspend_i,
 
   input  logic sd_cmd_done_i,
   input  logic sd_rsp_done_i,
@@ -36,6 +40,12 @@ module dat_wrap #(
   output logic request_cmd12_o,
   output logic pause_sd_clk_o,
 
+  output `writable_reg_t() block_gap_event_o,
+  output `writable_reg_t() continue_request_o,
+
+  output logic tuning_block_done_o,
+  output logic tuning_block_ok_o,
+
   input  sdhci_reg_pkg::sdhci_reg2hw_t reg2hw_i,
 
   output `writable_reg_t()       data_crc_error_o,
@@ -43,20 +53,45 @@ module dat_wrap #(
   output `writable_reg_t()       data_timeout_error_o,
 
   output logic [31:0]            buffer_data_port_d_o,
+  input  logic                   window_pop_i,
+  input  logic                   window_push_i,
+  input  logic [DataWidth-1:0]   window_push_data_i,
+  output logic [DataWidth-1:0]   window_pop_data_o,
   output `writable_reg_t()       buffer_read_enable_o,
   output `writable_reg_t()       buffer_write_enable_o,
 
   output `writable_reg_t()       read_transfer_active_o,
   output `writable_reg_t()       write_transfer_active_o,
 
-  output `writable_reg_t([15:0]) block_count_o
+  output `writable_reg_t([15:0]) block_count_o,
+
+  output logic        dma_req_o,
+  input  logic        dma_gnt_i,
+  output logic [31:0] dma_addr_o,
+  output logic        dma_we_o,
+  output logic [3:0]  dma_be_o,
+  output logic [31:0] dma_wdata_o,
+  input  logic        dma_rvalid_i,
+  input  logic [31:0] dma_rdata_i,
+  input  logic        dma_err_i,
+
+  output `writable_reg_t([31:0]) system_address_o,
+  output `writable_reg_t()       dma_interrupt_o,
+  output `writable_reg_t([3:0])  dma_error_o,
+
+  output `writable_reg_t([31:0]) adma_system_address_o,
+  output `writable_reg_t()       adma_error_o,
+  output sdhci_reg_pkg::sdhci_hw2reg_adma_error_status_reg_t adma_error_status_o
 );
 
   logic buffer_write_ready, buffer_write_valid, buffer_read_ready, buffer_read_valid, buffer_empty;
+  logic buffer_read_underrun;
   logic [31:0] buffer_write_data, buffer_read_data;
   logic start_read, read_valid, read_done, read_crc_err, read_end_bit_err;
   logic write_done, write_crc_timeout;
   logic timeout_elapsed;
+  logic dma_pop, dma_push, dma_busy;
+  logic [31:0] dma_push_data;
 
   logic [15:0] transmitted_block_counter_q, transmitted_block_counter_d;
   `FF (transmitted_block_counter_q, transmitted_block_counter_d, '0);
@@ -76,12 +111,14 @@ module dat_wrap #(
     BUSY_DONE
   } busy_state_e;
 
-  typedef enum logic [2:0] {
+  typedef enum logic [3:0] {
     WAIT_FOR_CMD,
     WAIT_FOR_READ_BUFFER,
     START_READING,
     READING,
     DONE_READING_BLOCK,
+    READ_GAP,
+    READ_SUSPEND,
     READING_BUSY,
     TIMEOUT_READING,
     DONE_READING
@@ -93,6 +130,7 @@ module dat_wrap #(
     START_WRITING,
     WRITING,
     DONE_WRITING_BLOCK,
+    WRITE_GAP,
     TIMEOUT_WRITING,
     DONE_WRITING
   } write_state_e;
@@ -142,6 +180,9 @@ module dat_wrap #(
       WRITE: begin
         if (write_state_q == DONE_WRITING) begin
           dat_state_d = READY;
+        end else if (suspend) begin
+          // The card programs the blocks it got, CMD12 is R1b
+          dat_state_d = cmd_needs_busy_i ? BUSY : READY;
         end
       end
 
@@ -214,6 +255,26 @@ module dat_wrap #(
     end
   end
 
+  // Stop at block gap, the transfer continues once the request is withdrawn and continue is set
+  logic stop_at_gap, continue_at_gap;
+  assign stop_at_gap     = reg2hw_i.block_gap_control.stop_at_block_gap_request.q;
+  assign continue_at_gap = !stop_at_gap && reg2hw_i.block_gap_control.continue_request.q;
+
+  // With block count disabled a multi block transfer never reaches its last block, it runs until
+  // the driver stops it at a block gap with CMD12, see below.
+  logic open_ended, last_block;
+  assign open_ended = reg2hw_i.transfer_mode.multi_single_block_select.q &&
+                      !reg2hw_i.transfer_mode.block_count_enable.q;
+  assign last_block = !open_ended && transmitted_block_counter_q == 'b1;
+
+  // A suspend or abort command (CMD12 for memory cards) at the gap ends the transfer instead.
+  // block_count is left at the blocks the card did not get or send yet, so the driver can resume
+  // with a new command from there.
+  logic suspend, suspended_q, suspended_d;
+  assign suspend = cmd_suspend_i && (read_state_q == READ_GAP || write_state_q == WRITE_GAP);
+  assign suspended_d = (suspended_q || suspend) && dat_state_q != READY;
+  `FF (suspended_q, suspended_d, '0);
+
   always_comb begin : read_fsm
     read_state_d = read_state_q;
 
@@ -245,16 +306,31 @@ module dat_wrap #(
           end
         end
         DONE_READING_BLOCK: begin
-          if (transmitted_block_counter_q == 'b1) begin
+          if (last_block) begin
             read_state_d = READING_BUSY;
+          end else if (stop_at_gap) begin
+            read_state_d = READ_GAP;
           end else if (buffer_write_ready) begin
             read_state_d = START_READING;
           end else begin
             read_state_d = WAIT_FOR_READ_BUFFER;
           end
         end
+        READ_GAP: begin
+          if (suspend) begin
+            read_state_d = READ_SUSPEND;
+          end else if (continue_at_gap) begin
+            read_state_d = WAIT_FOR_READ_BUFFER;
+          end
+        end
+        READ_SUSPEND: begin
+          // The card stops sending once it answered, what it sent until then is dropped
+          if (sd_rsp_done_i) begin
+            read_state_d = READING_BUSY;
+          end
+        end
         READING_BUSY: begin
-          if (buffer_empty) begin
+          if (buffer_empty && !dma_busy) begin
             read_state_d = DONE_READING;
           end
         end
@@ -286,6 +362,10 @@ module dat_wrap #(
         WAIT_FOR_WRITE_BUFFER: begin
           if (buffer_read_valid) begin
             write_state_d = START_WRITING;
+          end else if (stop_at_gap) begin
+            // The driver sets stop once it wrote its last block, so a write stops when the buffer
+            // ran dry and everything written to it went out
+            write_state_d = WRITE_GAP;
           end
         end
         START_WRITING: begin
@@ -302,12 +382,17 @@ module dat_wrap #(
           end
         end
         DONE_WRITING_BLOCK: begin
-          if (transmitted_block_counter_q == 'b1) begin
+          if (last_block) begin
             write_state_d = DONE_WRITING;
           end else begin
             write_state_d = WAIT_FOR_WRITE_BUFFER;
           end
         end
+        WRITE_GAP: begin
+          if (continue_at_gap) begin
+            write_state_d = WAIT_FOR_WRITE_BUFFER;
+          end
+        end
         TIMEOUT_WRITING: begin
           write_state_d = DONE_WRITING;
         end
@@ -339,13 +424,48 @@ module dat_wrap #(
   always_comb begin : autocmd12
     request_cmd12_o   = '0;
     if ((dat_state_q == READ || dat_state_q == WRITE) &
-        (dat_state_d == READY)) begin
+        (dat_state_d == READY) && !(suspended_q || suspend)) begin
       if (reg2hw_i.transfer_mode.auto_cmd12_enable.q) begin
         request_cmd12_o = '1;
       end
     end
   end
 
+  // Tuning blocks are checked against the pattern instead of landing in the buffer.
+  // Latched per transfer, the tuning engine clears execute_tuning right after the last block.
+  logic tuning;
+  `FFL (tuning, reg2hw_i.host_control_2.execute_tuning.q, dat_state_q == READY, '0);
+
+  logic [$clog2(sdhci_pkg::TuningBlockWords):0] tuning_word_q, tuning_word_d;
+  `FF (tuning_word_q, tuning_word_d, '0);
+
+  logic tuning_mismatch_q, tuning_mismatch_d;
+  `FF (tuning_mismatch_q, tuning_mismatch_d, '0);
+
+  always_comb begin : tuning_check
+    tuning_word_d     = tuning_word_q;
+    tuning_mismatch_d = tuning_mismatch_q;
+
+    if (read_state_q == START_READING) begin
+      tuning_word_d     = '0;
+      tuning_mismatch_d = '0;
+    end else if (read_state_q == READING && read_valid) begin
+      tuning_word_d = tuning_word_q + 1;
+      // The 8-bit pattern of CMD21 is longer, only its crc is checked
+      if (!reg2hw_i.host_control.extended_data_transfer_width.q) begin
+        if (tuning_word_q >= sdhci_pkg::TuningBlockWords ||
+            read_data != sdhci_pkg::TuningBlock4Bit[tuning_word_q]) begin
+          tuning_mismatch_d = '1;
+        end
+      end
+    end
+  end
+
+  assign tuning_block_done_o = tuning && dat_state_q == READ && read_state_q == READING &&
+                               (read_done || timeout_elapsed);
+  assign tuning_block_ok_o   = !timeout_elapsed && !read_crc_err && !read_end_bit_err &&
+                               !tuning_mismatch_d;
+
   assign read_transfer_active_o  = '{de: '1, d: dat_state_q == READ};
   assign write_transfer_active_o = '{de: '1, d: dat_state_q == WRITE};
 
@@ -361,13 +481,14 @@ module dat_wrap #(
     end
 
     if (dat_state_q == READ) begin
-      if (read_state_q == READING) begin
+      // A failing tuning block only tells the tuning engine to try the next tap
+      if (read_state_q == READING && !tuning) begin
         if (read_done) begin
           data_crc_error_o.de     = read_crc_err;
           data_end_bit_error_o.de = read_end_bit_err;
         end
       end
-      if (read_state_q == TIMEOUT_READING) begin
+      if (read_state_q == TIMEOUT_READING && !tuning) begin
         data_timeout_error_o.de = '1;
       end
     end
@@ -385,10 +506,15 @@ module dat_wrap #(
     end
   end
 
+  // The block count register loses every block the host writes, including those written ahead of
+  // or during WAIT_FOR_RSP, so they are added back.
+  logic [15:0] buffer_host_blocks;
   logic [15:0] new_block_count;
   always_comb begin
     if (reg2hw_i.transfer_mode.multi_single_block_select.q == 1'b0) begin
       new_block_count = 1'b1;
+    end else if (dat_state_q == WRITE && reg2hw_i.transfer_mode.block_count_enable.q) begin
+      new_block_count = reg2hw_i.block_count.q + buffer_host_blocks;
     end else begin
       new_block_count = reg2hw_i.block_count.q;
     end
@@ -411,6 +537,35 @@ module dat_wrap #(
     end
   end
 
+  // A read stops at the gap by pausing sd_clk, or with read wait by holding DAT2 low from the
+  // second sd_clk after the end bit. A write simply does not start the next block.
+  logic [1:0] gap_clocks_q, gap_clocks_d;
+  `FF (gap_clocks_q, gap_clocks_d, '0);
+
+  logic read_wait;
+  assign read_wait = read_state_q == READ_GAP && gap_clocks_q == 2'd2 &&
+                     reg2hw_i.block_gap_control.read_wait_control.q;
+
+  always_comb begin : block_gap
+    gap_clocks_d = '0;
+    if (read_state_q == READ_GAP) begin
+      gap_clocks_d = gap_clocks_q + 2'(sd_clk_en_p_i && gap_clocks_q != 2'd2);
+    end
+
+    block_gap_event_o = '{ de: '0, d: '1 };
+    if ((read_state_q != READ_GAP && read_state_d == READ_GAP) ||
+        (write_state_q != WRITE_GAP && write_state_d == WRITE_GAP)) begin
+      block_gap_event_o.de = '1;
+    end
+
+    continue_request_o = '{ de: '0, d: '0 };
+    if (read_state_q == READ_GAP || write_state_q == WRITE_GAP) begin
+      continue_request_o.de = continue_at_gap;
+    end else if (dat_state_q == READY) begin
+      continue_request_o.de = reg2hw_i.block_gap_control.continue_request.q;
+    end
+  end
+
   always_comb begin : busy_control
     busy_waiting = '0;
     if (dat_state_q == BUSY) begin
@@ -443,12 +598,18 @@ module dat_wrap #(
         start_read = '1;
       end
       READING: begin
-        if (read_valid) begin
+        if (read_valid && !tuning) begin
           buffer_write_valid = '1;
           buffer_write_data  = read_data;
         end
       end
       DONE_READING_BLOCK: ;
+      READ_GAP: begin
+        // A command needs sd_clk, without read wait the card then carries on sending
+        pause_sd_clk_o = !reg2hw_i.block_gap_control.read_wait_control.q &&
+                         !reg2hw_i.present_state.command_inhibit_cmd.q;
+      end
+      READ_SUSPEND: ;
       READING_BUSY: ;
       TIMEOUT_READING: ;
       DONE_READING: ;
@@ -475,6 +636,7 @@ module dat_wrap #(
         write_data = buffer_read_data;
       end
       DONE_WRITING_BLOCK: ;
+      WRITE_GAP: ;
       TIMEOUT_WRITING: ;
       DONE_WRITING: ;
       default: ;
@@ -494,9 +656,21 @@ module dat_wrap #(
   );
 
 
+  // The buffer counts blocks as the host moves them, which may be ahead of the card on writes. A
+  // suspended write drops a partly written block and goes back to the blocks the card has not got.
+  `writable_reg_t([15:0]) buffer_block_count;
+  always_comb begin : suspend_block_count
+    block_count_o = buffer_block_count;
+    if (suspend && write_state_q == WRITE_GAP && !open_ended) begin
+      block_count_o = '{ de: '1, d: transmitted_block_counter_q };
+    end
+  end
+
   dat_buffer #(
-    .NumWords        (256), // = 1024, Just enough to double buffer 512 byte blocks
-    .MaxBlockBitSize (MaxBlockBitSize)
+    .NumWords        (NumBufferBlocks * 512 * 8 / DataWidth),
+    .DataWidth       (DataWidth),
+    .MaxBlockBitSize (MaxBlockBitSize),
+    .DualPort        (DualPortBuffer)
   ) i_dat_buffer (
     .clk_i,
     .rst_ni,
@@ -504,9 +678,10 @@ module dat_wrap #(
     .read_operation_i  (reg2hw_i.present_state.read_transfer_active.q),
     .write_operation_i (reg2hw_i.present_state.write_transfer_active.q),
 
-    .read_ready_i  (buffer_read_ready),
-    .read_valid_o  (buffer_read_valid),
-    .read_data_o   (buffer_read_data),
+    .read_ready_i    (buffer_read_ready),
+    .read_valid_o    (buffer_read_valid),
+    .read_data_o     (buffer_read_data),
+    .read_underrun_o (buffer_read_underrun),
 
     .write_valid_i (buffer_write_valid),
     .write_data_i  (buffer_write_data),
@@ -514,18 +689,72 @@ module dat_wrap #(
 
     .empty_o       (buffer_empty),
 
+    .dma_pop_i       (dma_pop),
+    .dma_push_i      (dma_push),
+    .dma_push_data_i (dma_push_data),
+
+    .window_pop_i,
+    .window_push_i,
+    .window_push_data_i,
+    .window_pop_data_o,
+
     .reg2hw_i,
     .buffer_data_port_d_o,
     .buffer_read_enable_o,
     .buffer_write_enable_o,
-    .block_count_o
+    .block_count_o     (buffer_block_count),
+    .host_blocks_o     (buffer_host_blocks)
   );
 
+  sdhci_dma #(
+    .MaxBlockBitSize (MaxBlockBitSize)
+  ) i_dma (
+    .clk_i,
+    .rst_ni,
+
+    .reg2hw_i,
+
+    .read_operation_i  (reg2hw_i.present_state.read_transfer_active.q),
+    .write_operation_i (reg2hw_i.present_state.write_transfer_active.q),
+
+    .buffer_read_enable_i  (buffer_read_enable_o.d),
+    .buffer_write_enable_i (buffer_write_enable_o.d),
+    .buffer_pop_o          (dma_pop),
+    .buffer_pop_data_i     (buffer_data_port_d_o),
+    .buffer_push_o         (dma_push),
+    .buffer_push_data_o    (dma_push_data),
+
+    .mem_req_o    (dma_req_o),
+    .mem_gnt_i    (dma_gnt_i),
+    .mem_addr_o   (dma_addr_o),
+    .mem_we_o     (dma_we_o),
+    .mem_be_o     (dma_be_o),
+    .mem_wdata_o  (dma_wdata_o),
+    .mem_rvalid_i (dma_rvalid_i),
+    .mem_rdata_i  (dma_rdata_i),
+    .mem_err_i    (dma_err_i),
+
+    .busy_o (dma_busy),
+
+    .system_address_o,
+    .dma_interrupt_o,
+    .dma_error_o,
+
+    .adma_system_address_o,
+    .adma_error_o,
+    .adma_error_status_o
+  );
+
+  // An undivided sd clock has no falling edge in the clk_i domain, DDR50 is ignored there
+  logic ddr;
+  assign ddr = reg2hw_i.host_control_2.uhs_mode_select.q == 3'd4 && !div_1_i;
+
   dat_read #(
     .MaxBlockBitSize (MaxBlockBitSize)
   ) i_read (
     .clk_i,
     .sd_clk_en_i   (sd_clk_en_p_i),
+    .sd_clk_en_n_i (sd_clk_en_n_i),
     .rst_ni,
     .dat_i,
 
@@ -533,6 +762,8 @@ module dat_wrap #(
     .timeout_i        (timeout_elapsed),
     .block_size_i     (block_size),
     .bus_width_is_4_i (reg2hw_i.host_control.data_transfer_width.q),
+    .bus_width_is_8_i (reg2hw_i.host_control.extended_data_transfer_width.q),
+    .ddr_i            (ddr),
 
     .data_valid_o  (read_valid),
     .data_o        (read_data),
@@ -543,6 +774,13 @@ module dat_wrap #(
     .end_bit_err_o (read_end_bit_err)
   );
 
+  logic       write_dat_en;
+  logic [7:0] write_dat;
+
+  // There is only one output enable, the other lines are driven at their idle level
+  assign dat_en_o = write_dat_en | read_wait;
+  assign dat_o    = read_wait ? 8'b1111_1011 : write_dat;
+
   dat_write #(
     .MaxBlockBitSize (MaxBlockBitSize)
   ) i_write (
@@ -552,15 +790,19 @@ module dat_wrap #(
     .div_1_i        (div_1_i),
     .rst_ni,
     .dat0_i         (dat_i[0]),
-    .dat_o,
-    .dat_en_o,
+    .dat_o          (write_dat),
+    .dat_en_o       (write_dat_en),
 
     .start_i          (start_write),
     .block_size_i     (block_size),
     .bus_width_is_4_i (reg2hw_i.host_control.data_transfer_width.q),
+    .bus_width_is_8_i (reg2hw_i.host_control.extended_data_transfer_width.q),
+    .ddr_i            (ddr),
+    .high_speed_i     (reg2hw_i.host_control.high_speed_enable.q),
 
     .data_i        (write_data),
     .next_word_o   (write_requests_next_word),
+    .poison_i      (buffer_read_underrun),
 
     .data_timeout_o(write_crc_timeout),
     .waiting_o     (write_waiting),
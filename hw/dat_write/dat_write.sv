@@ -7,6 +7,9 @@
 // - Anton Buchner <abuchner@student.ethz.ch>
 
 //write 512-Byte data block
+//In DDR mode data and CRC are driven for both edges, with a separate CRC16 per edge.
+//The start bit, end bit and CRC status stay on the rising edge. DDR needs a divided sd clock.
+//In high speed mode data is launched one clk_i cycle after the rising edge instead of on the falling edge.
 
 `include "common_cells/registers.svh"
 
@@ -19,15 +22,19 @@ module dat_write #(
   input  logic       div_1_i,
   input  logic       rst_ni,
   input  logic       dat0_i,
-  output logic [3:0] dat_o,
+  output logic [7:0] dat_o,
   output logic       dat_en_o,
 
   input  logic                       start_i,
   input  logic [MaxBlockBitSize-1:0] block_size_i, // In bytes
   input  logic                       bus_width_is_4_i,
+  input  logic                       bus_width_is_8_i, // Takes precedence over bus_width_is_4_i
+  input  logic                       ddr_i,
+  input  logic                       high_speed_i,
 
   input  logic [31:0] data_i,
-  output logic        next_word_o, //active for one cycle when next data word should be made available. Got time for 7 sd clock cycles after to provide data
+  output logic        next_word_o, //active for one cycle when next data word should be made available. Got time for 7 sd clock cycles (3 with an 8 bit bus) after to provide data
+  input  logic        poison_i,    //the data of the current block is bad, its CRC is sent inverted so the card rejects it
 
   output logic data_timeout_o,
   output logic waiting_o,
@@ -35,7 +42,7 @@ module dat_write #(
   output logic crc_err_o,
   output logic end_bit_err_o
 );
-  // Need space for block_size_i * 8 + 16
+  // Need space for block_size_i * 8 + 32
   localparam int CounterWidth = MaxBlockBitSize + 4;
 
   typedef enum logic [3:0] {
@@ -56,13 +63,22 @@ module dat_write #(
   } dat_tx_state_e;
 
   dat_tx_state_e dat_tx_state_d, dat_tx_state_q;
-  `FFL (dat_tx_state_q, dat_tx_state_d, sd_clk_en_p_i, READY);
-
   logic [CounterWidth-1:0] counter_q, counter_d;
-  `FFL (counter_q, counter_d, sd_clk_en_p_i, 0);
+
+  // In DDR mode DAT and CRC step on both edges, skipping the falling edge right after the start bit
+  logic sd_clk_en_n_ddr, sd_clk_en_any;
+  assign sd_clk_en_n_ddr = ddr_i && sd_clk_en_n_i && (dat_tx_state_q inside {DAT, CRC}) && counter_q != '0;
+  assign sd_clk_en_any   = sd_clk_en_p_i || sd_clk_en_n_ddr;
+
+  `FFL (dat_tx_state_q, dat_tx_state_d, sd_clk_en_any, READY);
+  `FFL (counter_q, counter_d, sd_clk_en_any, 0);
+
+  logic [CounterWidth-1:0] crc_clock_count;
+  assign crc_clock_count = ddr_i ? 32 : 16;
 
   logic [CounterWidth-1:0] required_clock_count;
-  assign required_clock_count = bus_width_is_4_i ? 2*block_size_i : 8*block_size_i;
+  assign required_clock_count = bus_width_is_8_i ?   block_size_i :
+                                bus_width_is_4_i ? 2*block_size_i : 8*block_size_i;
 
   always_comb begin : dat_write_state_transition
     dat_tx_state_d  =   dat_tx_state_q;
@@ -71,7 +87,7 @@ module dat_write #(
       READY:            if (start_i) dat_tx_state_d = START_BIT;
       START_BIT:        dat_tx_state_d = DAT;
       DAT:              if (counter_q + 1 == required_clock_count) dat_tx_state_d = CRC;
-      CRC:              if (counter_q + 1 == required_clock_count + 16) dat_tx_state_d = END_BIT;
+      CRC:              if (counter_q + 1 == required_clock_count + crc_clock_count) dat_tx_state_d = END_BIT;
       END_BIT:          dat_tx_state_d = BUS_SWITCH;
 
       BUS_SWITCH:       if (counter_q + 1 == 2) dat_tx_state_d = STATUS_START_BIT;
@@ -87,7 +103,7 @@ module dat_write #(
   end
 
   logic [31:0] buffered_data_d, buffered_data_q;
-  `FFL (buffered_data_q, buffered_data_d, sd_clk_en_p_i, '0);
+  `FFL (buffered_data_q, buffered_data_d, sd_clk_en_any, '0);
 
   logic end_bit_err_q, end_bit_err_d;
   `FFL (end_bit_err_q, end_bit_err_d, sd_clk_en_p_i, '0);
@@ -98,20 +114,37 @@ module dat_write #(
   logic [2:0] status_q, status_d;
   `FFL (status_q, status_d, sd_clk_en_p_i, '0);
 
-  logic [3:0] dat, dat_div1, dat_divn;
+  logic [7:0] dat, dat_div1, dat_divn, dat_hs;
   
   //delay by half a clock cycle 
   always_ff @( negedge clk_i or negedge rst_ni) begin
-    if(!rst_ni) dat_div1 <= 4'b1;
+    if(!rst_ni) dat_div1 <= 8'b1;
     else dat_div1 <= dat;
   end
 
-  `FFL(dat_divn, dat, sd_clk_en_n_i, 4'b1, clk_i, rst_ni);
+  `FFL(dat_divn, dat, sd_clk_en_n_i, 8'b1, clk_i, rst_ni);
+
+  // hold the old bit for one clk_i cycle past the rising edge, the card gets the rest as setup time
+  logic sd_clk_en_p_q;
+  `FF(sd_clk_en_p_q, sd_clk_en_p_i, 1'b0, clk_i, rst_ni);
+  `FFL(dat_hs, dat, sd_clk_en_p_q, 8'b1, clk_i, rst_ni);
 
-  assign dat_o = (div_1_i)  ? dat_div1 :  dat_divn; 
+  // In DDR mode every edge needs new data, so the half cycle delay is used there as well
+  assign dat_o = (div_1_i || ddr_i) ? dat_div1 :
+                 high_speed_i       ? dat_hs   : dat_divn;
+
+  // The bit after a falling edge is sampled on the rising edge and vice versa
+  logic next_edge_is_p_q, next_edge_is_p_d;
+  assign next_edge_is_p_d = sd_clk_en_n_i ? 1'b1 : sd_clk_en_p_i ? 1'b0 : next_edge_is_p_q;
+  `FF (next_edge_is_p_q, next_edge_is_p_d, 1'b0);
+
+  logic poison_q, poison_d;
+  assign poison_d = (dat_tx_state_q == START_BIT) ? 1'b0 : poison_q || poison_i;
+  `FF (poison_q, poison_d, 1'b0);
 
   logic shift_out_crc;
-  logic [3:0] crc;
+  logic [7:0] crc, crc_p, crc_n;
+  assign crc = ((ddr_i && !next_edge_is_p_q) ? crc_n : crc_p) ^ {8{poison_q}};
 
   always_comb begin : dat_write_datapath
     dat_en_o = '0;
@@ -135,8 +168,9 @@ module dat_write #(
     unique case (dat_tx_state_q)
       START_BIT: begin
         dat_en_o = '1;
-        if (bus_width_is_4_i) dat = '0;
-        else                  dat = 4'b1110;
+        if      (bus_width_is_8_i) dat = '0;
+        else if (bus_width_is_4_i) dat = 8'b1111_0000;
+        else                       dat = 8'b1111_1110;
 
         buffered_data_d = data_i;
         end_bit_err_d   = '0;
@@ -148,10 +182,23 @@ module dat_write #(
         shift_out_crc = '0;
 
         dat_en_o = '1;
-        if (bus_width_is_4_i) begin
+        if (bus_width_is_8_i) begin
+          // Bus width = 8
+          if (counter_q[1:0] == '0) begin
+            next_word_o = sd_clk_en_any;
+          end
+
+          if (counter_q[1:0] == '1) begin
+            buffered_data_d = data_i;
+          end else begin
+            buffered_data_d = { 8'b0, buffered_data_q[31:8] };
+          end
+
+          dat = buffered_data_q[7:0];
+        end else if (bus_width_is_4_i) begin
           // Bus width = 4
           if (counter_q[2:0] == '0) begin
-            next_word_o = sd_clk_en_p_i;
+            next_word_o = sd_clk_en_any;
           end
 
           if (counter_q[2:0] == '1) begin
@@ -161,15 +208,15 @@ module dat_write #(
           end
 
           if (counter_q[0] == '0) begin
-            dat = buffered_data_q[7:4];
+            dat = { 4'hf, buffered_data_q[7:4] };
           end else begin
-            dat = buffered_data_q[3:0];
+            dat = { 4'hf, buffered_data_q[3:0] };
           end
         end else begin
           // Bus width = 1
 
           if (counter_q[4:0] == '0) begin
-            next_word_o = sd_clk_en_p_i;
+            next_word_o = sd_clk_en_any;
           end
 
           if (counter_q[4:0] == '1) begin
@@ -180,7 +227,7 @@ module dat_write #(
             buffered_data_d[7:0] = { buffered_data_q[6:0], 1'b0 };
           end
 
-          dat = { 3'b111, buffered_data_q[7] };
+          dat = { 7'h7f, buffered_data_q[7] };
         end
       end
       CRC: begin
@@ -188,10 +235,12 @@ module dat_write #(
         shift_out_crc = '1;
 
         dat_en_o = '1;
-        if (bus_width_is_4_i) begin
+        if (bus_width_is_8_i) begin
           dat = crc;
+        end else if (bus_width_is_4_i) begin
+          dat = { 4'hf, crc[3:0] };
         end else begin
-          dat = { 3'b111, crc[0] };
+          dat = { 7'h7f, crc[0] };
         end
       end
       END_BIT: begin
@@ -227,14 +276,24 @@ module dat_write #(
     endcase
   end
 
-  for (genvar i=0; i<4 ; i++) begin
+  for (genvar i=0; i<8 ; i++) begin
     crc16_write i_crc16_write (
       .clk_i,
       .sd_clk_en_i        (sd_clk_en_p_i),
       .rst_ni,
       .shift_out_crc16_i  (shift_out_crc),
       .dat_ser_i          (dat[i]),
-      .crc_ser_o          (crc[i])
+      .crc_ser_o          (crc_p[i])
+    );
+
+    // Falling edge bits in DDR mode, only shifts out zeros otherwise
+    crc16_write i_crc16_write_n (
+      .clk_i,
+      .sd_clk_en_i        (sd_clk_en_n_i),
+      .rst_ni,
+      .shift_out_crc16_i  (shift_out_crc || !sd_clk_en_n_ddr),
+      .dat_ser_i          (dat[i]),
+      .crc_ser_o          (crc_n[i])
     );
   end
 endmodule
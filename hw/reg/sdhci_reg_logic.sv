@@ -20,6 +20,7 @@ module sdhci_reg_logic (
   output sdhci_reg_pkg::sdhci_reg2hw_t reg2hw_modified_o,
 
   input logic sd_cmd_dat_busy_i,
+  input logic tuning_block_done_i,
 
   output `writable_reg_t() error_interrupt_o,
   output `writable_reg_t() auto_cmd12_error_o,
@@ -62,18 +63,13 @@ module sdhci_reg_logic (
     |( reg2hw_i.register``_status.field.q & // Is 1 \
         reg2hw_i.register``_signal_enable.field``_signal_enable.q)) // Should interrupt \
     
-  assign interrupt_signal_for_each_slot_o[7:1] = '0;
-  assign interrupt_signal_for_each_slot_o[0] =
-    // `should_interrupt(normal_interrupt, card_interrupt    ) |
-    `should_interrupt(normal_interrupt, card_removal      ) |
-    `should_interrupt(normal_interrupt, card_insertion    ) |
-    `should_interrupt(normal_interrupt, buffer_read_ready ) |
-    `should_interrupt(normal_interrupt, buffer_write_ready) |
-    // `should_interrupt(normal_interrupt, dma_interrupt     ) |
-    // `should_interrupt(normal_interrupt, block_gap_event   ) |
-    `should_interrupt(normal_interrupt, transfer_complete ) |
-    `should_interrupt(normal_interrupt, command_complete  ) |
+  `define did_signal(field) ( \
+    hw2reg_i.normal_interrupt_status.field.de & hw2reg_i.normal_interrupt_status.field.d & \
+    reg2hw_i.normal_interrupt_signal_enable.field``_signal_enable.q)
 
+  logic error_signal;
+  assign error_signal =
+    `should_interrupt(error_interrupt, adma_error           ) |
     `should_interrupt(error_interrupt, auto_cmd12_error     ) |
     // `should_interrupt(error_interrupt, current_limit_error  ) |
     `should_interrupt(error_interrupt, data_end_bit_error   ) |
@@ -82,20 +78,80 @@ module sdhci_reg_logic (
     `should_interrupt(error_interrupt, command_index_error  ) |
     `should_interrupt(error_interrupt, command_end_bit_error) |
     `should_interrupt(error_interrupt, command_crc_error    ) |
-    `should_interrupt(error_interrupt, command_timeout_error) /*|
-    `should_interrupt(error_interrupt, vendor_specific_error)*/;
+    `should_interrupt(error_interrupt, command_timeout_error) |
+    `should_interrupt(error_interrupt, vendor_specific_error);
 
+  assign interrupt_signal_for_each_slot_o[7:1] = '0;
+  assign interrupt_signal_for_each_slot_o[0] =
+    // `should_interrupt(normal_interrupt, card_interrupt    ) |
+    `should_interrupt(normal_interrupt, card_removal      ) |
+    `should_interrupt(normal_interrupt, card_insertion    ) |
+    `should_interrupt(normal_interrupt, buffer_read_ready ) |
+    `should_interrupt(normal_interrupt, buffer_write_ready) |
+    `should_interrupt(normal_interrupt, dma_interrupt     ) |
+    `should_interrupt(normal_interrupt, block_gap_event   ) |
+    `should_interrupt(normal_interrupt, transfer_complete ) |
+    `should_interrupt(normal_interrupt, command_complete  ) |
+    error_signal;
+
+  // Interrupt coalescing
+  // Buffer ready, dma and command complete of a running data transfer are counted and held back
+  // until `event_threshold` of them were seen or `timeout` cycles passed since the first one.
+  // Everything else, most importantly transfer complete and errors, raises the interrupt right
+  // away. It then stays raised until the driver cleared all signalled statuses.
+  logic in_transfer, coalesce, immediate_signal, coalesced_event;
+  assign in_transfer = reg2hw_i.present_state.command_inhibit_dat.q;
+  assign coalesce    = reg2hw_i.interrupt_coalescing.event_threshold.q != '0;
+
+  assign immediate_signal = error_signal |
+    `should_interrupt(normal_interrupt, card_removal     ) |
+    `should_interrupt(normal_interrupt, card_insertion   ) |
+    `should_interrupt(normal_interrupt, transfer_complete) |
+    `should_interrupt(normal_interrupt, block_gap_event  ) |
+    (`should_interrupt(normal_interrupt, command_complete) & !in_transfer);
+
+  assign coalesced_event =
+    `did_signal(buffer_read_ready ) |
+    `did_signal(buffer_write_ready) |
+    `did_signal(dma_interrupt     ) |
+    (`did_signal(command_complete) & in_transfer);
+
+  logic        raised_q, raised_d;
+  logic [7:0]  event_count_q, event_count_d;
+  logic [15:0] held_cycles_q, held_cycles_d;
+  `FF(raised_q, raised_d, '0);
+  `FF(event_count_q, event_count_d, '0);
+  `FF(held_cycles_q, held_cycles_d, '0);
+
+  always_comb begin : interrupt_coalescing
+    raised_d      = raised_q;
+    event_count_d = event_count_q;
+    held_cycles_d = held_cycles_q;
+
+    if (!interrupt_signal_for_each_slot_o[0] && !coalesced_event) begin
+      raised_d      = '0;
+      event_count_d = '0;
+      held_cycles_d = '0;
+    end else if (!raised_q) begin
+      // Both saturate, a count that runs on with the timeout off must not wrap below a limit
+      event_count_d = event_count_q + 8'(coalesced_event && event_count_q != '1);
+      held_cycles_d = held_cycles_q + 16'(held_cycles_q != '1);
+
+      if (immediate_signal ||
+          event_count_d >= reg2hw_i.interrupt_coalescing.event_threshold.q ||
+          (reg2hw_i.interrupt_coalescing.timeout.q != '0 &&
+           held_cycles_d >= reg2hw_i.interrupt_coalescing.timeout.q)) begin
+        raised_d = '1;
+      end
+    end
+  end
 
-  /* logic interrupt_status_q, interrupt_status_d; */
-  /* `FF(interrupt_status_q, interrupt_status_d, '0); */
-  /* assign interrupt_status_d = interrupt_signal_for_each_slot_o[0]; */
-
-  // Send interrupt if any interupt status went from 0 to 1
-  assign interrupt_o = interrupt_signal_for_each_slot_o[0];
+  assign interrupt_o = interrupt_signal_for_each_slot_o[0] & (!coalesce | raised_q);
 
   // Automatically write to Error Interrupt Status
   assign error_interrupt_o.d = rst_ni &
-    (//(|`instant_reg_value(error_interrupt_status, vendor_specific_error)) |
+    ((|`instant_reg_value(error_interrupt_status, vendor_specific_error)) |
+       `instant_reg_value(error_interrupt_status, adma_error           )  |
        `instant_reg_value(error_interrupt_status, auto_cmd12_error     )  |
       //  `instant_reg_value(error_interrupt_status, current_limit_error  )  |
        `instant_reg_value(error_interrupt_status, data_end_bit_error   )  |
@@ -118,11 +174,15 @@ module sdhci_reg_logic (
      `did_get_set(auto_cmd12_error_status, auto_cmd12_timeout_error              ) |
      `did_get_set(auto_cmd12_error_status, auto_cmd12_not_executed               ));
 
+  // The dma engine moves the data, so the host doesn't need to know about the buffer.
+  // Tuning blocks never reach the buffer, each one is signalled on its own.
   assign buffer_read_ready_o.d = '1;
-  assign buffer_read_ready_o.de = rst_dat_ni & `did_get_set(present_state, buffer_read_enable);
+  assign buffer_read_ready_o.de = rst_dat_ni & (tuning_block_done_i |
+    (!reg2hw_i.transfer_mode.dma_enable.q & `did_get_set(present_state, buffer_read_enable)));
 
   assign buffer_write_ready_o.d = '1;
-  assign buffer_write_ready_o.de = rst_dat_ni & `did_get_set(present_state, buffer_write_enable);
+  assign buffer_write_ready_o.de = rst_dat_ni & !reg2hw_i.transfer_mode.dma_enable.q &
+    `did_get_set(present_state, buffer_write_enable);
 
 
   // technically, dat_line_active should be 0 once the last block of a read
@@ -169,6 +229,8 @@ module sdhci_reg_logic (
         !reg2hw_i.present_state.command_inhibit_cmd.q && reg2hw_i.transfer_mode.data_transfer_direction_select.qe, '0)
   `FFL (transfer_mode_reg_o.auto_cmd12_enable             .d, reg2hw_i.transfer_mode.auto_cmd12_enable             .q,
         !reg2hw_i.present_state.command_inhibit_cmd.q && reg2hw_i.transfer_mode.auto_cmd12_enable             .qe, '0)
+  `FFL (transfer_mode_reg_o.auto_cmd23_enable             .d, reg2hw_i.transfer_mode.auto_cmd23_enable             .q,
+        !reg2hw_i.present_state.command_inhibit_cmd.q && reg2hw_i.transfer_mode.auto_cmd23_enable             .qe, '0)
   `FFL (transfer_mode_reg_o.block_count_enable            .d, reg2hw_i.transfer_mode.block_count_enable            .q,
         !reg2hw_i.present_state.command_inhibit_cmd.q && reg2hw_i.transfer_mode.block_count_enable            .qe, '0)
   `FFL (transfer_mode_reg_o.dma_enable                    .d, reg2hw_i.transfer_mode.dma_enable                    .q,
@@ -179,8 +241,12 @@ module sdhci_reg_logic (
   `FFL (block_size, reg2hw_i.block_size.transfer_block_size.q,
         !reg2hw_i.present_state.command_inhibit_dat.q && reg2hw_i.block_size.transfer_block_size.qe, '0);
 
+  logic [2:0] host_dma_buffer_boundary;
+  `FFL (host_dma_buffer_boundary, reg2hw_i.block_size.host_dma_buffer_boundary.q,
+        !reg2hw_i.present_state.command_inhibit_dat.q && reg2hw_i.block_size.host_dma_buffer_boundary.qe, '0);
+
   assign block_size_reg_o.transfer_block_size.d = block_size;
-  assign block_size_reg_o.host_dma_buffer_boundary.d = '0;
+  assign block_size_reg_o.host_dma_buffer_boundary.d = host_dma_buffer_boundary;
 
   logic [15:0] block_count_q, block_count_d;
   `FF (block_count_q, block_count_d, '0);
@@ -200,10 +266,12 @@ module sdhci_reg_logic (
     reg2hw_modified_o.transfer_mode.multi_single_block_select     .q = transfer_mode_reg_o.multi_single_block_select     .d;
     reg2hw_modified_o.transfer_mode.data_transfer_direction_select.q = transfer_mode_reg_o.data_transfer_direction_select.d;
     reg2hw_modified_o.transfer_mode.auto_cmd12_enable             .q = transfer_mode_reg_o.auto_cmd12_enable             .d;
+    reg2hw_modified_o.transfer_mode.auto_cmd23_enable             .q = transfer_mode_reg_o.auto_cmd23_enable             .d;
     reg2hw_modified_o.transfer_mode.block_count_enable            .q = transfer_mode_reg_o.block_count_enable            .d;
     reg2hw_modified_o.transfer_mode.dma_enable                    .q = transfer_mode_reg_o.dma_enable                    .d;
 
-    reg2hw_modified_o.block_size.transfer_block_size.q = block_size_reg_o.transfer_block_size.d;
+    reg2hw_modified_o.block_size.transfer_block_size.q      = block_size_reg_o.transfer_block_size.d;
+    reg2hw_modified_o.block_size.host_dma_buffer_boundary.q = block_size_reg_o.host_dma_buffer_boundary.d;
 
     reg2hw_modified_o.block_count.q = block_count_o;
   end
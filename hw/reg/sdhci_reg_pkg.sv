@@ -13,6 +13,11 @@ package sdhci_reg_pkg;
   // Typedefs for registers //
   ////////////////////////////
 
+  typedef struct packed {
+    logic [31:0] q;
+    logic        qe;
+  } sdhci_reg2hw_system_address_reg_t;
+
   typedef struct packed {
     struct packed {
       logic [11:0] q;
@@ -46,6 +51,10 @@ package sdhci_reg_pkg;
       logic        q;
       logic        qe;
     } auto_cmd12_enable;
+    struct packed {
+      logic        q;
+      logic        qe;
+    } auto_cmd23_enable;
     struct packed {
       logic        q;
       logic        qe;
@@ -157,6 +166,12 @@ package sdhci_reg_pkg;
     struct packed {
       logic        q;
     } high_speed_enable;
+    struct packed {
+      logic [1:0]  q;
+    } dma_select;
+    struct packed {
+      logic        q;
+    } extended_data_transfer_width;
   } sdhci_reg2hw_host_control_reg_t;
 
   typedef struct packed {
@@ -208,6 +223,10 @@ package sdhci_reg_pkg;
       logic        q;
       logic        qe;
     } sd_clock_enable;
+    struct packed {
+      logic [1:0]  q;
+      logic        qe;
+    } upper_bits_of_sdclk_frequency_select;
     struct packed {
       logic [7:0]  q;
       logic        qe;
@@ -239,6 +258,12 @@ package sdhci_reg_pkg;
     struct packed {
       logic        q;
     } transfer_complete;
+    struct packed {
+      logic        q;
+    } block_gap_event;
+    struct packed {
+      logic        q;
+    } dma_interrupt;
     struct packed {
       logic        q;
     } buffer_write_ready;
@@ -281,6 +306,12 @@ package sdhci_reg_pkg;
     struct packed {
       logic        q;
     } auto_cmd12_error;
+    struct packed {
+      logic        q;
+    } adma_error;
+    struct packed {
+      logic [3:0]  q;
+    } vendor_specific_error;
   } sdhci_reg2hw_error_interrupt_status_reg_t;
 
   typedef struct packed {
@@ -344,6 +375,9 @@ package sdhci_reg_pkg;
     struct packed {
       logic        q;
     } auto_cmd12_error_status_enable;
+    struct packed {
+      logic        q;
+    } adma_error_status_enable;
     struct packed {
       logic [3:0]  q;
     } vendor_specific_error_status_enable;
@@ -407,6 +441,9 @@ package sdhci_reg_pkg;
     struct packed {
       logic        q;
     } auto_cmd12_error_signal_enable;
+    struct packed {
+      logic        q;
+    } adma_error_signal_enable;
     struct packed {
       logic [3:0]  q;
     } vendor_specific_error_signal_enable;
@@ -433,6 +470,58 @@ package sdhci_reg_pkg;
     } command_not_issued_by_auto_cmd12_error;
   } sdhci_reg2hw_auto_cmd12_error_status_reg_t;
 
+  typedef struct packed {
+    struct packed {
+      logic [2:0]  q;
+    } uhs_mode_select;
+    struct packed {
+      logic        q;
+    } signaling_1_8v_enable;
+    struct packed {
+      logic        q;
+    } execute_tuning;
+    struct packed {
+      logic        q;
+    } sampling_clock_select;
+  } sdhci_reg2hw_host_control_2_reg_t;
+
+  typedef struct packed {
+    logic [31:0] q;
+  } sdhci_reg2hw_adma_system_address_reg_t;
+
+  typedef struct packed {
+    logic [31:0] q;
+  } sdhci_reg2hw_adma_system_address_upper_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [7:0]  q;
+    } event_threshold;
+    struct packed {
+      logic [15:0] q;
+    } timeout;
+  } sdhci_reg2hw_interrupt_coalescing_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic        q;
+    } write_prefill;
+    struct packed {
+      logic [7:0]  q;
+    } cut_through_words;
+    struct packed {
+      logic [7:0]  q;
+    } read_watermark;
+    struct packed {
+      logic [7:0]  q;
+    } write_watermark;
+  } sdhci_reg2hw_buffer_control_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } sdhci_hw2reg_system_address_reg_t;
+
   typedef struct packed {
     struct packed {
       logic [11:0] d;
@@ -456,6 +545,9 @@ package sdhci_reg_pkg;
     struct packed {
       logic        d;
     } auto_cmd12_enable;
+    struct packed {
+      logic        d;
+    } auto_cmd23_enable;
     struct packed {
       logic        d;
     } data_transfer_direction_select;
@@ -543,6 +635,13 @@ package sdhci_reg_pkg;
     } cmd_line_signal_level;
   } sdhci_hw2reg_present_state_reg_t;
 
+  typedef struct packed {
+    struct packed {
+      logic        d;
+      logic        de;
+    } continue_request;
+  } sdhci_hw2reg_block_gap_control_reg_t;
+
   typedef struct packed {
     struct packed {
       logic        d;
@@ -570,6 +669,14 @@ package sdhci_reg_pkg;
       logic        d;
       logic        de;
     } transfer_complete;
+    struct packed {
+      logic        d;
+      logic        de;
+    } block_gap_event;
+    struct packed {
+      logic        d;
+      logic        de;
+    } dma_interrupt;
     struct packed {
       logic        d;
       logic        de;
@@ -625,6 +732,14 @@ package sdhci_reg_pkg;
       logic        d;
       logic        de;
     } auto_cmd12_error;
+    struct packed {
+      logic        d;
+      logic        de;
+    } adma_error;
+    struct packed {
+      logic [3:0]  d;
+      logic        de;
+    } vendor_specific_error;
   } sdhci_hw2reg_error_interrupt_status_reg_t;
 
   typedef struct packed {
@@ -654,6 +769,41 @@ package sdhci_reg_pkg;
     } command_not_issued_by_auto_cmd12_error;
   } sdhci_hw2reg_auto_cmd12_error_status_reg_t;
 
+  typedef struct packed {
+    struct packed {
+      logic        d;
+      logic        de;
+    } execute_tuning;
+    struct packed {
+      logic        d;
+      logic        de;
+    } sampling_clock_select;
+  } sdhci_hw2reg_host_control_2_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [1:0]  d;
+      logic        de;
+    } adma_error_state;
+    struct packed {
+      logic        d;
+      logic        de;
+    } adma_length_mismatch_error;
+  } sdhci_hw2reg_adma_error_status_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } sdhci_hw2reg_adma_system_address_reg_t;
+
+  typedef struct packed {
+    logic [7:0]  d;
+  } sdhci_hw2reg_command_queue_status_reg_t;
+
+  typedef struct packed {
+    logic [7:0]  d;
+  } sdhci_hw2reg_buffer_data_window_reg_t;
+
   typedef struct packed {
     struct packed {
       logic [7:0]  d;
@@ -662,49 +812,62 @@ package sdhci_reg_pkg;
 
   // Register -> HW type
   typedef struct packed {
-    sdhci_reg2hw_block_size_reg_t block_size; // [374:358]
-    sdhci_reg2hw_block_count_reg_t block_count; // [357:341]
-    sdhci_reg2hw_argument_reg_t argument; // [340:309]
-    sdhci_reg2hw_transfer_mode_reg_t transfer_mode; // [308:299]
-    sdhci_reg2hw_command_reg_t command; // [298:280]
-    sdhci_reg2hw_response0_reg_t response0; // [279:248]
-    sdhci_reg2hw_response1_reg_t response1; // [247:216]
-    sdhci_reg2hw_response2_reg_t response2; // [215:184]
-    sdhci_reg2hw_response3_reg_t response3; // [183:152]
-    sdhci_reg2hw_buffer_data_port_reg_t buffer_data_port; // [151:118]
-    sdhci_reg2hw_present_state_reg_t present_state; // [117:102]
-    sdhci_reg2hw_host_control_reg_t host_control; // [101:99]
-    sdhci_reg2hw_power_control_reg_t power_control; // [98:95]
-    sdhci_reg2hw_block_gap_control_reg_t block_gap_control; // [94:91]
-    sdhci_reg2hw_wakeup_control_reg_t wakeup_control; // [90:88]
-    sdhci_reg2hw_clock_control_reg_t clock_control; // [87:73]
-    sdhci_reg2hw_timeout_control_reg_t timeout_control; // [72:69]
-    sdhci_reg2hw_software_reset_reg_t software_reset; // [68:66]
-    sdhci_reg2hw_normal_interrupt_status_reg_t normal_interrupt_status; // [65:59]
-    sdhci_reg2hw_error_interrupt_status_reg_t error_interrupt_status; // [58:51]
-    sdhci_reg2hw_normal_interrupt_status_enable_reg_t normal_interrupt_status_enable; // [50:41]
-    sdhci_reg2hw_error_interrupt_status_enable_reg_t error_interrupt_status_enable; // [40:28]
-    sdhci_reg2hw_normal_interrupt_signal_enable_reg_t normal_interrupt_signal_enable; // [27:19]
-    sdhci_reg2hw_error_interrupt_signal_enable_reg_t error_interrupt_signal_enable; // [18:6]
-    sdhci_reg2hw_auto_cmd12_error_status_reg_t auto_cmd12_error_status; // [5:0]
+    sdhci_reg2hw_system_address_reg_t system_address; // [543:511]
+    sdhci_reg2hw_block_size_reg_t block_size; // [510:494]
+    sdhci_reg2hw_block_count_reg_t block_count; // [493:477]
+    sdhci_reg2hw_argument_reg_t argument; // [476:445]
+    sdhci_reg2hw_transfer_mode_reg_t transfer_mode; // [444:433]
+    sdhci_reg2hw_command_reg_t command; // [432:414]
+    sdhci_reg2hw_response0_reg_t response0; // [413:382]
+    sdhci_reg2hw_response1_reg_t response1; // [381:350]
+    sdhci_reg2hw_response2_reg_t response2; // [349:318]
+    sdhci_reg2hw_response3_reg_t response3; // [317:286]
+    sdhci_reg2hw_buffer_data_port_reg_t buffer_data_port; // [285:252]
+    sdhci_reg2hw_present_state_reg_t present_state; // [251:236]
+    sdhci_reg2hw_host_control_reg_t host_control; // [235:230]
+    sdhci_reg2hw_power_control_reg_t power_control; // [229:226]
+    sdhci_reg2hw_block_gap_control_reg_t block_gap_control; // [225:222]
+    sdhci_reg2hw_wakeup_control_reg_t wakeup_control; // [221:219]
+    sdhci_reg2hw_clock_control_reg_t clock_control; // [218:201]
+    sdhci_reg2hw_timeout_control_reg_t timeout_control; // [200:197]
+    sdhci_reg2hw_software_reset_reg_t software_reset; // [196:194]
+    sdhci_reg2hw_normal_interrupt_status_reg_t normal_interrupt_status; // [193:185]
+    sdhci_reg2hw_error_interrupt_status_reg_t error_interrupt_status; // [184:172]
+    sdhci_reg2hw_normal_interrupt_status_enable_reg_t normal_interrupt_status_enable; // [171:162]
+    sdhci_reg2hw_error_interrupt_status_enable_reg_t error_interrupt_status_enable; // [161:148]
+    sdhci_reg2hw_normal_interrupt_signal_enable_reg_t normal_interrupt_signal_enable; // [147:139]
+    sdhci_reg2hw_error_interrupt_signal_enable_reg_t error_interrupt_signal_enable; // [138:125]
+    sdhci_reg2hw_auto_cmd12_error_status_reg_t auto_cmd12_error_status; // [124:119]
+    sdhci_reg2hw_host_control_2_reg_t host_control_2; // [118:113]
+    sdhci_reg2hw_adma_system_address_reg_t adma_system_address; // [112:81]
+    sdhci_reg2hw_adma_system_address_upper_reg_t adma_system_address_upper; // [80:49]
+    sdhci_reg2hw_interrupt_coalescing_reg_t interrupt_coalescing; // [48:25]
+    sdhci_reg2hw_buffer_control_reg_t buffer_control; // [24:0]
   } sdhci_reg2hw_t;
 
   // HW -> register type
   typedef struct packed {
-    sdhci_hw2reg_block_size_reg_t block_size; // [284:270]
-    sdhci_hw2reg_block_count_reg_t block_count; // [269:254]
-    sdhci_hw2reg_transfer_mode_reg_t transfer_mode; // [253:249]
-    sdhci_hw2reg_response0_reg_t response0; // [248:216]
-    sdhci_hw2reg_response1_reg_t response1; // [215:183]
-    sdhci_hw2reg_response2_reg_t response2; // [182:150]
-    sdhci_hw2reg_response3_reg_t response3; // [149:117]
-    sdhci_hw2reg_buffer_data_port_reg_t buffer_data_port; // [116:85]
-    sdhci_hw2reg_present_state_reg_t present_state; // [84:56]
-    sdhci_hw2reg_clock_control_reg_t clock_control; // [55:54]
-    sdhci_hw2reg_software_reset_reg_t software_reset; // [53:50]
-    sdhci_hw2reg_normal_interrupt_status_reg_t normal_interrupt_status; // [49:36]
-    sdhci_hw2reg_error_interrupt_status_reg_t error_interrupt_status; // [35:20]
-    sdhci_hw2reg_auto_cmd12_error_status_reg_t auto_cmd12_error_status; // [19:8]
+    sdhci_hw2reg_system_address_reg_t system_address; // [389:357]
+    sdhci_hw2reg_block_size_reg_t block_size; // [356:342]
+    sdhci_hw2reg_block_count_reg_t block_count; // [341:326]
+    sdhci_hw2reg_transfer_mode_reg_t transfer_mode; // [325:320]
+    sdhci_hw2reg_response0_reg_t response0; // [319:287]
+    sdhci_hw2reg_response1_reg_t response1; // [286:254]
+    sdhci_hw2reg_response2_reg_t response2; // [253:221]
+    sdhci_hw2reg_response3_reg_t response3; // [220:188]
+    sdhci_hw2reg_buffer_data_port_reg_t buffer_data_port; // [187:156]
+    sdhci_hw2reg_present_state_reg_t present_state; // [155:127]
+    sdhci_hw2reg_block_gap_control_reg_t block_gap_control; // [126:125]
+    sdhci_hw2reg_clock_control_reg_t clock_control; // [124:123]
+    sdhci_hw2reg_software_reset_reg_t software_reset; // [122:119]
+    sdhci_hw2reg_normal_interrupt_status_reg_t normal_interrupt_status; // [118:101]
+    sdhci_hw2reg_error_interrupt_status_reg_t error_interrupt_status; // [100:78]
+    sdhci_hw2reg_auto_cmd12_error_status_reg_t auto_cmd12_error_status; // [77:66]
+    sdhci_hw2reg_host_control_2_reg_t host_control_2; // [65:62]
+    sdhci_hw2reg_adma_error_status_reg_t adma_error_status; // [61:57]
+    sdhci_hw2reg_adma_system_address_reg_t adma_system_address; // [56:24]
+    sdhci_hw2reg_command_queue_status_reg_t command_queue_status; // [23:16]
+    sdhci_hw2reg_buffer_data_window_reg_t buffer_data_window; // [15:8]
     sdhci_hw2reg_slot_interrupt_status_reg_t slot_interrupt_status; // [7:0]
   } sdhci_hw2reg_t;
 
@@ -735,10 +898,18 @@ package sdhci_reg_pkg;
   parameter logic [BlockAw-1:0] SDHCI_NORMAL_INTERRUPT_SIGNAL_ENABLE_OFFSET = 8'h 38;
   parameter logic [BlockAw-1:0] SDHCI_ERROR_INTERRUPT_SIGNAL_ENABLE_OFFSET = 8'h 38;
   parameter logic [BlockAw-1:0] SDHCI_AUTO_CMD12_ERROR_STATUS_OFFSET = 8'h 3c;
+  parameter logic [BlockAw-1:0] SDHCI_HOST_CONTROL_2_OFFSET = 8'h 3c;
   parameter logic [BlockAw-1:0] SDHCI_CAPABILITIES_OFFSET = 8'h 40;
   parameter logic [BlockAw-1:0] SDHCI_CAPABILITIES_RESERVED_OFFSET = 8'h 44;
   parameter logic [BlockAw-1:0] SDHCI_MAXIMUM_CURRENT_CAPABILITIES_OFFSET = 8'h 48;
   parameter logic [BlockAw-1:0] SDHCI_MAXIMUM_CURRENT_CAPABILITIES_RESERVED_OFFSET = 8'h 4c;
+  parameter logic [BlockAw-1:0] SDHCI_ADMA_ERROR_STATUS_OFFSET = 8'h 54;
+  parameter logic [BlockAw-1:0] SDHCI_ADMA_SYSTEM_ADDRESS_OFFSET = 8'h 58;
+  parameter logic [BlockAw-1:0] SDHCI_ADMA_SYSTEM_ADDRESS_UPPER_OFFSET = 8'h 5c;
+  parameter logic [BlockAw-1:0] SDHCI_COMMAND_QUEUE_STATUS_OFFSET = 8'h c0;
+  parameter logic [BlockAw-1:0] SDHCI_BUFFER_DATA_WINDOW_OFFSET = 8'h c4;
+  parameter logic [BlockAw-1:0] SDHCI_INTERRUPT_COALESCING_OFFSET = 8'h c8;
+  parameter logic [BlockAw-1:0] SDHCI_BUFFER_CONTROL_OFFSET = 8'h cc;
   parameter logic [BlockAw-1:0] SDHCI_SLOT_INTERRUPT_STATUS_OFFSET = 8'h fc;
   parameter logic [BlockAw-1:0] SDHCI_HOST_CONTROLLER_VERSION_OFFSET = 8'h fc;
 
@@ -747,10 +918,11 @@ package sdhci_reg_pkg;
   parameter logic [0:0] SDHCI_BLOCK_SIZE_RSVD_15_RESVAL = 1'h 0;
   parameter logic [31:0] SDHCI_BLOCK_COUNT_RESVAL = 32'h 0;
   parameter logic [15:0] SDHCI_TRANSFER_MODE_RESVAL = 16'h 0;
-  parameter logic [0:0] SDHCI_TRANSFER_MODE_RSVD_3_RESVAL = 1'h 0;
   parameter logic [1:0] SDHCI_TRANSFER_MODE_RSVD_6_RESVAL = 2'h 0;
   parameter logic [7:0] SDHCI_TRANSFER_MODE_RSVD_8_RESVAL = 8'h 0;
   parameter logic [31:0] SDHCI_BUFFER_DATA_PORT_RESVAL = 32'h 0;
+  parameter logic [7:0] SDHCI_COMMAND_QUEUE_STATUS_RESVAL = 8'h 0;
+  parameter logic [7:0] SDHCI_BUFFER_DATA_WINDOW_RESVAL = 8'h 0;
   parameter logic [15:0] SDHCI_SLOT_INTERRUPT_STATUS_RESVAL = 16'h 0;
   parameter logic [7:0] SDHCI_SLOT_INTERRUPT_STATUS_INTERRUPT_SIGNAL_FOR_EACH_SLOT_RESVAL = 8'h 0;
   parameter logic [7:0] SDHCI_SLOT_INTERRUPT_STATUS_RSVD_8_RESVAL = 8'h 0;
@@ -783,16 +955,24 @@ package sdhci_reg_pkg;
     SDHCI_NORMAL_INTERRUPT_SIGNAL_ENABLE,
     SDHCI_ERROR_INTERRUPT_SIGNAL_ENABLE,
     SDHCI_AUTO_CMD12_ERROR_STATUS,
+    SDHCI_HOST_CONTROL_2,
     SDHCI_CAPABILITIES,
     SDHCI_CAPABILITIES_RESERVED,
     SDHCI_MAXIMUM_CURRENT_CAPABILITIES,
     SDHCI_MAXIMUM_CURRENT_CAPABILITIES_RESERVED,
+    SDHCI_ADMA_ERROR_STATUS,
+    SDHCI_ADMA_SYSTEM_ADDRESS,
+    SDHCI_ADMA_SYSTEM_ADDRESS_UPPER,
+    SDHCI_COMMAND_QUEUE_STATUS,
+    SDHCI_BUFFER_DATA_WINDOW,
+    SDHCI_INTERRUPT_COALESCING,
+    SDHCI_BUFFER_CONTROL,
     SDHCI_SLOT_INTERRUPT_STATUS,
     SDHCI_HOST_CONTROLLER_VERSION
   } sdhci_id_e;
 
   // Register bytemaks used to see if a register is to be written to 
-  parameter logic [3:0] SDHCI_BYTEMASK [32] = '{
+  parameter logic [3:0] SDHCI_BYTEMASK [40] = '{
     4'b 1111, // index[ 0] SDHCI_SYSTEM_ADDRESS
     4'b 0011, // index[ 1] SDHCI_BLOCK_SIZE
     4'b 1100, // index[ 2] SDHCI_BLOCK_COUNT
@@ -819,16 +999,24 @@ package sdhci_reg_pkg;
     4'b 0011, // index[23] SDHCI_NORMAL_INTERRUPT_SIGNAL_ENABLE
     4'b 1100, // index[24] SDHCI_ERROR_INTERRUPT_SIGNAL_ENABLE
     4'b 0011, // index[25] SDHCI_AUTO_CMD12_ERROR_STATUS
-    4'b 1111, // index[26] SDHCI_CAPABILITIES
-    4'b 1111, // index[27] SDHCI_CAPABILITIES_RESERVED
-    4'b 1111, // index[28] SDHCI_MAXIMUM_CURRENT_CAPABILITIES
-    4'b 1111, // index[29] SDHCI_MAXIMUM_CURRENT_CAPABILITIES_RESERVED
-    4'b 0011, // index[30] SDHCI_SLOT_INTERRUPT_STATUS
-    4'b 1100  // index[31] SDHCI_HOST_CONTROLLER_VERSION
+    4'b 1100, // index[26] SDHCI_HOST_CONTROL_2
+    4'b 1111, // index[27] SDHCI_CAPABILITIES
+    4'b 1111, // index[28] SDHCI_CAPABILITIES_RESERVED
+    4'b 1111, // index[29] SDHCI_MAXIMUM_CURRENT_CAPABILITIES
+    4'b 1111, // index[30] SDHCI_MAXIMUM_CURRENT_CAPABILITIES_RESERVED
+    4'b 1111, // index[31] SDHCI_ADMA_ERROR_STATUS
+    4'b 1111, // index[32] SDHCI_ADMA_SYSTEM_ADDRESS
+    4'b 1111, // index[33] SDHCI_ADMA_SYSTEM_ADDRESS_UPPER
+    4'b 0001, // index[34] SDHCI_COMMAND_QUEUE_STATUS
+    4'b 0001, // index[35] SDHCI_BUFFER_DATA_WINDOW
+    4'b 1111, // index[36] SDHCI_INTERRUPT_COALESCING
+    4'b 1111, // index[37] SDHCI_BUFFER_CONTROL
+    4'b 0011, // index[38] SDHCI_SLOT_INTERRUPT_STATUS
+    4'b 1100  // index[39] SDHCI_HOST_CONTROLLER_VERSION
   };
 
   // Register boudary crossing infromation to make sure we don't write to half of a field
-  parameter logic [2:0] SDHCI_DISALLOWED_BOUNDARY_CROSSINGS [32] = '{
+  parameter logic [2:0] SDHCI_DISALLOWED_BOUNDARY_CROSSINGS [40] = '{
     3'b 111, // index[ 0] SDHCI_SYSTEM_ADDRESS
     3'b 001, // index[ 1] SDHCI_BLOCK_SIZE
     3'b 100, // index[ 2] SDHCI_BLOCK_COUNT
@@ -855,12 +1043,20 @@ package sdhci_reg_pkg;
     3'b 000, // index[23] SDHCI_NORMAL_INTERRUPT_SIGNAL_ENABLE
     3'b 000, // index[24] SDHCI_ERROR_INTERRUPT_SIGNAL_ENABLE
     3'b 000, // index[25] SDHCI_AUTO_CMD12_ERROR_STATUS
-    3'b 000, // index[26] SDHCI_CAPABILITIES
-    3'b 111, // index[27] SDHCI_CAPABILITIES_RESERVED
-    3'b 000, // index[28] SDHCI_MAXIMUM_CURRENT_CAPABILITIES
-    3'b 111, // index[29] SDHCI_MAXIMUM_CURRENT_CAPABILITIES_RESERVED
-    3'b 000, // index[30] SDHCI_SLOT_INTERRUPT_STATUS
-    3'b 000  // index[31] SDHCI_HOST_CONTROLLER_VERSION
+    3'b 000, // index[26] SDHCI_HOST_CONTROL_2
+    3'b 000, // index[27] SDHCI_CAPABILITIES
+    3'b 111, // index[28] SDHCI_CAPABILITIES_RESERVED
+    3'b 000, // index[29] SDHCI_MAXIMUM_CURRENT_CAPABILITIES
+    3'b 111, // index[30] SDHCI_MAXIMUM_CURRENT_CAPABILITIES_RESERVED
+    3'b 111, // index[31] SDHCI_ADMA_ERROR_STATUS
+    3'b 111, // index[32] SDHCI_ADMA_SYSTEM_ADDRESS
+    3'b 111, // index[33] SDHCI_ADMA_SYSTEM_ADDRESS_UPPER
+    3'b 000, // index[34] SDHCI_COMMAND_QUEUE_STATUS
+    3'b 000, // index[35] SDHCI_BUFFER_DATA_WINDOW
+    3'b 100, // index[36] SDHCI_INTERRUPT_COALESCING
+    3'b 000, // index[37] SDHCI_BUFFER_CONTROL
+    3'b 000, // index[38] SDHCI_SLOT_INTERRUPT_STATUS
+    3'b 000  // index[39] SDHCI_HOST_CONTROLLER_VERSION
   };
 
 endpackage
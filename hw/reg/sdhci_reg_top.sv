@@ -100,8 +100,10 @@ module sdhci_reg_top #(
   logic transfer_mode_auto_cmd12_enable_wd;
   logic transfer_mode_auto_cmd12_enable_we;
   logic transfer_mode_auto_cmd12_enable_re;
-  logic transfer_mode_rsvd_3_qs;
-  logic transfer_mode_rsvd_3_re;
+  logic transfer_mode_auto_cmd23_enable_qs;
+  logic transfer_mode_auto_cmd23_enable_wd;
+  logic transfer_mode_auto_cmd23_enable_we;
+  logic transfer_mode_auto_cmd23_enable_re;
   logic transfer_mode_data_transfer_direction_select_qs;
   logic transfer_mode_data_transfer_direction_select_wd;
   logic transfer_mode_data_transfer_direction_select_we;
@@ -167,7 +169,13 @@ module sdhci_reg_top #(
   logic host_control_high_speed_enable_qs;
   logic host_control_high_speed_enable_wd;
   logic host_control_high_speed_enable_we;
-  logic [4:0] host_control_rsvd_3_qs;
+  logic [1:0] host_control_dma_select_qs;
+  logic [1:0] host_control_dma_select_wd;
+  logic host_control_dma_select_we;
+  logic host_control_extended_data_transfer_width_qs;
+  logic host_control_extended_data_transfer_width_wd;
+  logic host_control_extended_data_transfer_width_we;
+  logic [1:0] host_control_rsvd_6_qs;
   logic power_control_sd_bus_power_qs;
   logic power_control_sd_bus_power_wd;
   logic power_control_sd_bus_power_we;
@@ -205,7 +213,10 @@ module sdhci_reg_top #(
   logic clock_control_sd_clock_enable_qs;
   logic clock_control_sd_clock_enable_wd;
   logic clock_control_sd_clock_enable_we;
-  logic [4:0] clock_control_rsvd_3_qs;
+  logic [2:0] clock_control_rsvd_3_qs;
+  logic [1:0] clock_control_upper_bits_of_sdclk_frequency_select_qs;
+  logic [1:0] clock_control_upper_bits_of_sdclk_frequency_select_wd;
+  logic clock_control_upper_bits_of_sdclk_frequency_select_we;
   logic [7:0] clock_control_sdclk_frequency_select_qs;
   logic [7:0] clock_control_sdclk_frequency_select_wd;
   logic clock_control_sdclk_frequency_select_we;
@@ -277,7 +288,10 @@ module sdhci_reg_top #(
   logic error_interrupt_status_auto_cmd12_error_qs;
   logic error_interrupt_status_auto_cmd12_error_wd;
   logic error_interrupt_status_auto_cmd12_error_we;
-  logic [2:0] error_interrupt_status_rsvd_9_qs;
+  logic error_interrupt_status_adma_error_qs;
+  logic error_interrupt_status_adma_error_wd;
+  logic error_interrupt_status_adma_error_we;
+  logic [1:0] error_interrupt_status_rsvd_10_qs;
   logic [3:0] error_interrupt_status_vendor_specific_error_qs;
   logic [3:0] error_interrupt_status_vendor_specific_error_wd;
   logic error_interrupt_status_vendor_specific_error_we;
@@ -337,7 +351,10 @@ module sdhci_reg_top #(
   logic error_interrupt_status_enable_auto_cmd12_error_status_enable_qs;
   logic error_interrupt_status_enable_auto_cmd12_error_status_enable_wd;
   logic error_interrupt_status_enable_auto_cmd12_error_status_enable_we;
-  logic [2:0] error_interrupt_status_enable_rsvd_9_qs;
+  logic error_interrupt_status_enable_adma_error_status_enable_qs;
+  logic error_interrupt_status_enable_adma_error_status_enable_wd;
+  logic error_interrupt_status_enable_adma_error_status_enable_we;
+  logic [1:0] error_interrupt_status_enable_rsvd_10_qs;
   logic [3:0] error_interrupt_status_enable_vendor_specific_error_status_enable_qs;
   logic [3:0] error_interrupt_status_enable_vendor_specific_error_status_enable_wd;
   logic error_interrupt_status_enable_vendor_specific_error_status_enable_we;
@@ -397,7 +414,10 @@ module sdhci_reg_top #(
   logic error_interrupt_signal_enable_auto_cmd12_error_signal_enable_qs;
   logic error_interrupt_signal_enable_auto_cmd12_error_signal_enable_wd;
   logic error_interrupt_signal_enable_auto_cmd12_error_signal_enable_we;
-  logic [2:0] error_interrupt_signal_enable_rsvd_9_qs;
+  logic error_interrupt_signal_enable_adma_error_signal_enable_qs;
+  logic error_interrupt_signal_enable_adma_error_signal_enable_wd;
+  logic error_interrupt_signal_enable_adma_error_signal_enable_we;
+  logic [1:0] error_interrupt_signal_enable_rsvd_10_qs;
   logic [3:0] error_interrupt_signal_enable_vendor_specific_error_signal_enable_qs;
   logic [3:0] error_interrupt_signal_enable_vendor_specific_error_signal_enable_wd;
   logic error_interrupt_signal_enable_vendor_specific_error_signal_enable_we;
@@ -409,13 +429,29 @@ module sdhci_reg_top #(
   logic [1:0] auto_cmd12_error_status_rsvd_5_qs;
   logic auto_cmd12_error_status_command_not_issued_by_auto_cmd12_error_qs;
   logic [7:0] auto_cmd12_error_status_rsvd_8_qs;
+  logic [2:0] host_control_2_uhs_mode_select_qs;
+  logic [2:0] host_control_2_uhs_mode_select_wd;
+  logic host_control_2_uhs_mode_select_we;
+  logic host_control_2_signaling_1_8v_enable_qs;
+  logic host_control_2_signaling_1_8v_enable_wd;
+  logic host_control_2_signaling_1_8v_enable_we;
+  logic [1:0] host_control_2_rsvd_4_qs;
+  logic host_control_2_execute_tuning_qs;
+  logic host_control_2_execute_tuning_wd;
+  logic host_control_2_execute_tuning_we;
+  logic host_control_2_sampling_clock_select_qs;
+  logic host_control_2_sampling_clock_select_wd;
+  logic host_control_2_sampling_clock_select_we;
+  logic [7:0] host_control_2_rsvd_8_qs;
   logic [5:0] capabilities_timeout_clock_frequency_qs;
   logic capabilities_rsvd_6_qs;
   logic capabilities_timeout_clock_unit_qs;
   logic [5:0] capabilities_base_clock_frequency_for_sd_clock_qs;
   logic [1:0] capabilities_rsvd_14_qs;
   logic [1:0] capabilities_max_block_length_qs;
-  logic [2:0] capabilities_rsvd_18_qs;
+  logic capabilities_embedded_8bit_support_qs;
+  logic capabilities_adma2_support_qs;
+  logic capabilities_rsvd_20_qs;
   logic capabilities_high_speed_support_qs;
   logic capabilities_dma_support_qs;
   logic capabilities_suspend_resume_support_qs;
@@ -423,12 +459,48 @@ module sdhci_reg_top #(
   logic capabilities_voltage_support_3_0v_qs;
   logic capabilities_voltage_support_1_8v_qs;
   logic [4:0] capabilities_rsvd_27_qs;
-  logic [31:0] capabilities_reserved_qs;
+  logic capabilities_reserved_sdr50_support_qs;
+  logic capabilities_reserved_sdr104_support_qs;
+  logic capabilities_reserved_ddr50_support_qs;
+  logic [9:0] capabilities_reserved_rsvd_3_qs;
+  logic capabilities_reserved_use_tuning_for_sdr50_qs;
+  logic [17:0] capabilities_reserved_rsvd_14_qs;
   logic [7:0] maximum_current_capabilities_maximum_current_for_3_3v_qs;
   logic [7:0] maximum_current_capabilities_maximum_current_for_3_0v_qs;
   logic [7:0] maximum_current_capabilities_maximum_current_for_1_8v_qs;
   logic [7:0] maximum_current_capabilities_rsvd_24_qs;
   logic [31:0] maximum_current_capabilities_reserved_qs;
+  logic [1:0] adma_error_status_adma_error_state_qs;
+  logic adma_error_status_adma_length_mismatch_error_qs;
+  logic [28:0] adma_error_status_rsvd_3_qs;
+  logic [31:0] adma_system_address_qs;
+  logic [31:0] adma_system_address_wd;
+  logic adma_system_address_we;
+  logic [31:0] adma_system_address_upper_qs;
+  logic [31:0] adma_system_address_upper_wd;
+  logic adma_system_address_upper_we;
+  logic [7:0] command_queue_status_qs;
+  logic command_queue_status_re;
+  logic [7:0] buffer_data_window_qs;
+  logic buffer_data_window_re;
+  logic [7:0] interrupt_coalescing_event_threshold_qs;
+  logic [7:0] interrupt_coalescing_event_threshold_wd;
+  logic interrupt_coalescing_event_threshold_we;
+  logic [15:0] interrupt_coalescing_timeout_qs;
+  logic [15:0] interrupt_coalescing_timeout_wd;
+  logic interrupt_coalescing_timeout_we;
+  logic buffer_control_write_prefill_qs;
+  logic buffer_control_write_prefill_wd;
+  logic buffer_control_write_prefill_we;
+  logic [7:0] buffer_control_cut_through_words_qs;
+  logic [7:0] buffer_control_cut_through_words_wd;
+  logic buffer_control_cut_through_words_we;
+  logic [7:0] buffer_control_read_watermark_qs;
+  logic [7:0] buffer_control_read_watermark_wd;
+  logic buffer_control_read_watermark_we;
+  logic [7:0] buffer_control_write_watermark_qs;
+  logic [7:0] buffer_control_write_watermark_wd;
+  logic buffer_control_write_watermark_we;
   logic [7:0] slot_interrupt_status_interrupt_signal_for_each_slot_qs;
   logic slot_interrupt_status_interrupt_signal_for_each_slot_re;
   logic [7:0] slot_interrupt_status_rsvd_8_qs;
@@ -452,12 +524,12 @@ module sdhci_reg_top #(
     .wd     (system_address_wd),
 
     // from internal hardware
-    .de     (1'b0),
-    .d      ('0  ),
+    .de     (hw2reg.system_address.de),
+    .d      (hw2reg.system_address.d ),
 
     // to internal hardware
-    .qe     (),
-    .q      (),
+    .qe     (reg2hw.system_address.qe),
+    .q      (reg2hw.system_address.q ),
 
     // to register interface (read)
     .qs     (system_address_qs)
@@ -601,18 +673,18 @@ module sdhci_reg_top #(
   );
 
 
-  //   F[rsvd_3]: 3:3
+  //   F[auto_cmd23_enable]: 3:3
   prim_subreg_ext #(
     .DW    (1)
-  ) u_transfer_mode_rsvd_3 (
-    .re     (transfer_mode_rsvd_3_re),
-    .we     (1'b0),
-    .wd     ('0),
-    .d      ('0),
+  ) u_transfer_mode_auto_cmd23_enable (
+    .re     (transfer_mode_auto_cmd23_enable_re),
+    .we     (transfer_mode_auto_cmd23_enable_we),
+    .wd     (transfer_mode_auto_cmd23_enable_wd),
+    .d      (hw2reg.transfer_mode.auto_cmd23_enable.d),
     .qre    (),
-    .qe     (),
-    .q      (),
-    .qs     (transfer_mode_rsvd_3_qs)
+    .qe     (reg2hw.transfer_mode.auto_cmd23_enable.qe),
+    .q      (reg2hw.transfer_mode.auto_cmd23_enable.q ),
+    .qs     (transfer_mode_auto_cmd23_enable_qs)
   );
 
 
@@ -1386,9 +1458,61 @@ module sdhci_reg_top #(
   );
 
 
-  //   F[rsvd_3]: 7:3
+  //   F[dma_select]: 4:3
+  prim_subreg #(
+    .DW      (2),
+    .SWACCESS("RW"),
+    .RESVAL  (2'h0)
+  ) u_host_control_dma_select (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (host_control_dma_select_we),
+    .wd     (host_control_dma_select_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.host_control.dma_select.q ),
+
+    // to register interface (read)
+    .qs     (host_control_dma_select_qs)
+  );
+
+
+  //   F[extended_data_transfer_width]: 5:5
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RW"),
+    .RESVAL  (1'h0)
+  ) u_host_control_extended_data_transfer_width (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (host_control_extended_data_transfer_width_we),
+    .wd     (host_control_extended_data_transfer_width_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.host_control.extended_data_transfer_width.q ),
+
+    // to register interface (read)
+    .qs     (host_control_extended_data_transfer_width_qs)
+  );
+
+
+  //   F[rsvd_6]: 7:6
   // constant-only read
-  assign host_control_rsvd_3_qs = 5'h0;
+  assign host_control_rsvd_6_qs = 2'h0;
 
 
   // R[power_control]: V(False)
@@ -1492,8 +1616,8 @@ module sdhci_reg_top #(
     .wd     (block_gap_control_continue_request_wd),
 
     // from internal hardware
-    .de     (1'b0),
-    .d      ('0  ),
+    .de     (hw2reg.block_gap_control.continue_request.de),
+    .d      (hw2reg.block_gap_control.continue_request.d ),
 
     // to internal hardware
     .qe     (),
@@ -1725,9 +1849,35 @@ module sdhci_reg_top #(
   );
 
 
-  //   F[rsvd_3]: 7:3
+  //   F[rsvd_3]: 5:3
   // constant-only read
-  assign clock_control_rsvd_3_qs = 5'h0;
+  assign clock_control_rsvd_3_qs = 3'h0;
+
+
+  //   F[upper_bits_of_sdclk_frequency_select]: 7:6
+  prim_subreg #(
+    .DW      (2),
+    .SWACCESS("RW"),
+    .RESVAL  (2'h0)
+  ) u_clock_control_upper_bits_of_sdclk_frequency_select (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (clock_control_upper_bits_of_sdclk_frequency_select_we),
+    .wd     (clock_control_upper_bits_of_sdclk_frequency_select_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (reg2hw.clock_control.upper_bits_of_sdclk_frequency_select.qe),
+    .q      (reg2hw.clock_control.upper_bits_of_sdclk_frequency_select.q ),
+
+    // to register interface (read)
+    .qs     (clock_control_upper_bits_of_sdclk_frequency_select_qs)
+  );
 
 
   //   F[sdclk_frequency_select]: 15:8
@@ -1942,12 +2092,12 @@ module sdhci_reg_top #(
     .wd     (normal_interrupt_status_block_gap_event_wd),
 
     // from internal hardware
-    .de     (1'b0),
-    .d      ('0  ),
+    .de     (hw2reg.normal_interrupt_status.block_gap_event.de),
+    .d      (hw2reg.normal_interrupt_status.block_gap_event.d ),
 
     // to internal hardware
     .qe     (),
-    .q      (),
+    .q      (reg2hw.normal_interrupt_status.block_gap_event.q ),
 
     // to register interface (read)
     .qs     (normal_interrupt_status_block_gap_event_qs)
@@ -1968,12 +2118,12 @@ module sdhci_reg_top #(
     .wd     (normal_interrupt_status_dma_interrupt_wd),
 
     // from internal hardware
-    .de     (1'b0),
-    .d      ('0  ),
+    .de     (hw2reg.normal_interrupt_status.dma_interrupt.de),
+    .d      (hw2reg.normal_interrupt_status.dma_interrupt.d ),
 
     // to internal hardware
     .qe     (),
-    .q      (),
+    .q      (reg2hw.normal_interrupt_status.dma_interrupt.q ),
 
     // to register interface (read)
     .qs     (normal_interrupt_status_dma_interrupt_qs)
@@ -2355,9 +2505,35 @@ module sdhci_reg_top #(
   );
 
 
-  //   F[rsvd_9]: 27:25
+  //   F[adma_error]: 25:25
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("W1C"),
+    .RESVAL  (1'h0)
+  ) u_error_interrupt_status_adma_error (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (error_interrupt_status_adma_error_we),
+    .wd     (error_interrupt_status_adma_error_wd),
+
+    // from internal hardware
+    .de     (hw2reg.error_interrupt_status.adma_error.de),
+    .d      (hw2reg.error_interrupt_status.adma_error.d ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.error_interrupt_status.adma_error.q ),
+
+    // to register interface (read)
+    .qs     (error_interrupt_status_adma_error_qs)
+  );
+
+
+  //   F[rsvd_10]: 27:26
   // constant-only read
-  assign error_interrupt_status_rsvd_9_qs = 3'h0;
+  assign error_interrupt_status_rsvd_10_qs = 2'h0;
 
 
   //   F[vendor_specific_error]: 31:28
@@ -2374,12 +2550,12 @@ module sdhci_reg_top #(
     .wd     (error_interrupt_status_vendor_specific_error_wd),
 
     // from internal hardware
-    .de     (1'b0),
-    .d      ('0  ),
+    .de     (hw2reg.error_interrupt_status.vendor_specific_error.de),
+    .d      (hw2reg.error_interrupt_status.vendor_specific_error.d ),
 
     // to internal hardware
     .qe     (),
-    .q      (),
+    .q      (reg2hw.error_interrupt_status.vendor_specific_error.q ),
 
     // to register interface (read)
     .qs     (error_interrupt_status_vendor_specific_error_qs)
@@ -2888,9 +3064,35 @@ module sdhci_reg_top #(
   );
 
 
-  //   F[rsvd_9]: 27:25
+  //   F[adma_error_status_enable]: 25:25
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RW"),
+    .RESVAL  (1'h0)
+  ) u_error_interrupt_status_enable_adma_error_status_enable (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (error_interrupt_status_enable_adma_error_status_enable_we),
+    .wd     (error_interrupt_status_enable_adma_error_status_enable_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.error_interrupt_status_enable.adma_error_status_enable.q ),
+
+    // to register interface (read)
+    .qs     (error_interrupt_status_enable_adma_error_status_enable_qs)
+  );
+
+
+  //   F[rsvd_10]: 27:26
   // constant-only read
-  assign error_interrupt_status_enable_rsvd_9_qs = 3'h0;
+  assign error_interrupt_status_enable_rsvd_10_qs = 2'h0;
 
 
   //   F[vendor_specific_error_status_enable]: 31:28
@@ -3401,9 +3603,35 @@ module sdhci_reg_top #(
   );
 
 
-  //   F[rsvd_9]: 27:25
+  //   F[adma_error_signal_enable]: 25:25
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RW"),
+    .RESVAL  (1'h0)
+  ) u_error_interrupt_signal_enable_adma_error_signal_enable (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (error_interrupt_signal_enable_adma_error_signal_enable_we),
+    .wd     (error_interrupt_signal_enable_adma_error_signal_enable_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.error_interrupt_signal_enable.adma_error_signal_enable.q ),
+
+    // to register interface (read)
+    .qs     (error_interrupt_signal_enable_adma_error_signal_enable_qs)
+  );
+
+
+  //   F[rsvd_10]: 27:26
   // constant-only read
-  assign error_interrupt_signal_enable_rsvd_9_qs = 3'h0;
+  assign error_interrupt_signal_enable_rsvd_10_qs = 2'h0;
 
 
   //   F[vendor_specific_error_signal_enable]: 31:28
@@ -3594,6 +3822,122 @@ module sdhci_reg_top #(
   assign auto_cmd12_error_status_rsvd_8_qs = 8'h0;
 
 
+  // R[host_control_2]: V(False)
+
+  //   F[uhs_mode_select]: 18:16
+  prim_subreg #(
+    .DW      (3),
+    .SWACCESS("RW"),
+    .RESVAL  (3'h0)
+  ) u_host_control_2_uhs_mode_select (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (host_control_2_uhs_mode_select_we),
+    .wd     (host_control_2_uhs_mode_select_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.host_control_2.uhs_mode_select.q ),
+
+    // to register interface (read)
+    .qs     (host_control_2_uhs_mode_select_qs)
+  );
+
+
+  //   F[signaling_1_8v_enable]: 19:19
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RW"),
+    .RESVAL  (1'h0)
+  ) u_host_control_2_signaling_1_8v_enable (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (host_control_2_signaling_1_8v_enable_we),
+    .wd     (host_control_2_signaling_1_8v_enable_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.host_control_2.signaling_1_8v_enable.q ),
+
+    // to register interface (read)
+    .qs     (host_control_2_signaling_1_8v_enable_qs)
+  );
+
+
+  //   F[rsvd_4]: 21:20
+  // constant-only read
+  assign host_control_2_rsvd_4_qs = 2'h0;
+
+
+  //   F[execute_tuning]: 22:22
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RW"),
+    .RESVAL  (1'h0)
+  ) u_host_control_2_execute_tuning (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (host_control_2_execute_tuning_we),
+    .wd     (host_control_2_execute_tuning_wd),
+
+    // from internal hardware
+    .de     (hw2reg.host_control_2.execute_tuning.de),
+    .d      (hw2reg.host_control_2.execute_tuning.d ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.host_control_2.execute_tuning.q ),
+
+    // to register interface (read)
+    .qs     (host_control_2_execute_tuning_qs)
+  );
+
+
+  //   F[sampling_clock_select]: 23:23
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RW"),
+    .RESVAL  (1'h0)
+  ) u_host_control_2_sampling_clock_select (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (host_control_2_sampling_clock_select_we),
+    .wd     (host_control_2_sampling_clock_select_wd),
+
+    // from internal hardware
+    .de     (hw2reg.host_control_2.sampling_clock_select.de),
+    .d      (hw2reg.host_control_2.sampling_clock_select.d ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.host_control_2.sampling_clock_select.q ),
+
+    // to register interface (read)
+    .qs     (host_control_2_sampling_clock_select_qs)
+  );
+
+
+  //   F[rsvd_8]: 31:24
+  // constant-only read
+  assign host_control_2_rsvd_8_qs = 8'h0;
+
+
   // R[capabilities]: V(False)
 
   //   F[timeout_clock_frequency]: 5:0
@@ -3626,24 +3970,34 @@ module sdhci_reg_top #(
   assign capabilities_max_block_length_qs = 2'h0;
 
 
-  //   F[rsvd_18]: 20:18
+  //   F[embedded_8bit_support]: 18:18
+  // constant-only read
+  assign capabilities_embedded_8bit_support_qs = 1'h1;
+
+
+  //   F[adma2_support]: 19:19
+  // constant-only read
+  assign capabilities_adma2_support_qs = 1'h1;
+
+
+  //   F[rsvd_20]: 20:20
   // constant-only read
-  assign capabilities_rsvd_18_qs = 3'h0;
+  assign capabilities_rsvd_20_qs = 1'h0;
 
 
   //   F[high_speed_support]: 21:21
   // constant-only read
-  assign capabilities_high_speed_support_qs = 1'h0;
+  assign capabilities_high_speed_support_qs = 1'h1;
 
 
   //   F[dma_support]: 22:22
   // constant-only read
-  assign capabilities_dma_support_qs = 1'h0;
+  assign capabilities_dma_support_qs = 1'h1;
 
 
   //   F[suspend_resume_support]: 23:23
   // constant-only read
-  assign capabilities_suspend_resume_support_qs = 1'h0;
+  assign capabilities_suspend_resume_support_qs = 1'h1;
 
 
   //   F[voltage_support_3_3v]: 24:24
@@ -3668,8 +4022,34 @@ module sdhci_reg_top #(
 
   // R[capabilities_reserved]: V(False)
 
+  //   F[sdr50_support]: 0:0
+  // constant-only read
+  assign capabilities_reserved_sdr50_support_qs = 1'h1;
+
+
+  //   F[sdr104_support]: 1:1
+  // constant-only read
+  assign capabilities_reserved_sdr104_support_qs = 1'h1;
+
+
+  //   F[ddr50_support]: 2:2
+  // constant-only read
+  assign capabilities_reserved_ddr50_support_qs = 1'h1;
+
+
+  //   F[rsvd_3]: 12:3
+  // constant-only read
+  assign capabilities_reserved_rsvd_3_qs = 10'h0;
+
+
+  //   F[use_tuning_for_sdr50]: 13:13
+  // constant-only read
+  assign capabilities_reserved_use_tuning_for_sdr50_qs = 1'h1;
+
+
+  //   F[rsvd_14]: 31:14
   // constant-only read
-  assign capabilities_reserved_qs = 32'h0;
+  assign capabilities_reserved_rsvd_14_qs = 18'h0;
 
 
   // R[maximum_current_capabilities]: V(False)
@@ -3700,19 +4080,322 @@ module sdhci_reg_top #(
   assign maximum_current_capabilities_reserved_qs = 32'h0;
 
 
-  // R[slot_interrupt_status]: V(True)
+  // R[adma_error_status]: V(False)
 
-  //   F[interrupt_signal_for_each_slot]: 7:0
-  prim_subreg_ext #(
-    .DW    (8)
-  ) u_slot_interrupt_status_interrupt_signal_for_each_slot (
-    .re     (slot_interrupt_status_interrupt_signal_for_each_slot_re),
-    .we     (1'b0),
-    .wd     ('0),
-    .d      (hw2reg.slot_interrupt_status.interrupt_signal_for_each_slot.d),
-    .qre    (),
-    .qe     (),
-    .q      (),
+  //   F[adma_error_state]: 1:0
+  prim_subreg #(
+    .DW      (2),
+    .SWACCESS("RO"),
+    .RESVAL  (2'h0)
+  ) u_adma_error_status_adma_error_state (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    .we     (1'b0),
+    .wd     ('0  ),
+
+    // from internal hardware
+    .de     (hw2reg.adma_error_status.adma_error_state.de),
+    .d      (hw2reg.adma_error_status.adma_error_state.d ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (),
+
+    // to register interface (read)
+    .qs     (adma_error_status_adma_error_state_qs)
+  );
+
+
+  //   F[adma_length_mismatch_error]: 2:2
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RO"),
+    .RESVAL  (1'h0)
+  ) u_adma_error_status_adma_length_mismatch_error (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    .we     (1'b0),
+    .wd     ('0  ),
+
+    // from internal hardware
+    .de     (hw2reg.adma_error_status.adma_length_mismatch_error.de),
+    .d      (hw2reg.adma_error_status.adma_length_mismatch_error.d ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (),
+
+    // to register interface (read)
+    .qs     (adma_error_status_adma_length_mismatch_error_qs)
+  );
+
+
+  //   F[rsvd_3]: 31:3
+  // constant-only read
+  assign adma_error_status_rsvd_3_qs = 29'h0;
+
+
+  // R[adma_system_address]: V(False)
+
+  prim_subreg #(
+    .DW      (32),
+    .SWACCESS("RW"),
+    .RESVAL  (32'h0)
+  ) u_adma_system_address (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (adma_system_address_we),
+    .wd     (adma_system_address_wd),
+
+    // from internal hardware
+    .de     (hw2reg.adma_system_address.de),
+    .d      (hw2reg.adma_system_address.d ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.adma_system_address.q ),
+
+    // to register interface (read)
+    .qs     (adma_system_address_qs)
+  );
+
+
+  // R[adma_system_address_upper]: V(False)
+
+  prim_subreg #(
+    .DW      (32),
+    .SWACCESS("RW"),
+    .RESVAL  (32'h0)
+  ) u_adma_system_address_upper (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (adma_system_address_upper_we),
+    .wd     (adma_system_address_upper_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.adma_system_address_upper.q ),
+
+    // to register interface (read)
+    .qs     (adma_system_address_upper_qs)
+  );
+
+
+  // R[command_queue_status]: V(True)
+
+  prim_subreg_ext #(
+    .DW    (8)
+  ) u_command_queue_status (
+    .re     (command_queue_status_re),
+    .we     (1'b0),
+    .wd     ('0),
+    .d      (hw2reg.command_queue_status.d),
+    .qre    (),
+    .qe     (),
+    .q      (),
+    .qs     (command_queue_status_qs)
+  );
+
+
+  // R[buffer_data_window]: V(True)
+
+  prim_subreg_ext #(
+    .DW    (8)
+  ) u_buffer_data_window (
+    .re     (buffer_data_window_re),
+    .we     (1'b0),
+    .wd     ('0),
+    .d      (hw2reg.buffer_data_window.d),
+    .qre    (),
+    .qe     (),
+    .q      (),
+    .qs     (buffer_data_window_qs)
+  );
+
+
+  // R[interrupt_coalescing]: V(False)
+
+  //   F[event_threshold]: 7:0
+  prim_subreg #(
+    .DW      (8),
+    .SWACCESS("RW"),
+    .RESVAL  (8'h0)
+  ) u_interrupt_coalescing_event_threshold (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (interrupt_coalescing_event_threshold_we),
+    .wd     (interrupt_coalescing_event_threshold_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.interrupt_coalescing.event_threshold.q ),
+
+    // to register interface (read)
+    .qs     (interrupt_coalescing_event_threshold_qs)
+  );
+
+
+  //   F[timeout]: 31:16
+  prim_subreg #(
+    .DW      (16),
+    .SWACCESS("RW"),
+    .RESVAL  (16'h0)
+  ) u_interrupt_coalescing_timeout (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (interrupt_coalescing_timeout_we),
+    .wd     (interrupt_coalescing_timeout_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.interrupt_coalescing.timeout.q ),
+
+    // to register interface (read)
+    .qs     (interrupt_coalescing_timeout_qs)
+  );
+
+
+  // R[buffer_control]: V(False)
+
+  //   F[write_prefill]: 0:0
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RW"),
+    .RESVAL  (1'h0)
+  ) u_buffer_control_write_prefill (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (buffer_control_write_prefill_we),
+    .wd     (buffer_control_write_prefill_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.buffer_control.write_prefill.q ),
+
+    // to register interface (read)
+    .qs     (buffer_control_write_prefill_qs)
+  );
+
+
+  //   F[cut_through_words]: 15:8
+  prim_subreg #(
+    .DW      (8),
+    .SWACCESS("RW"),
+    .RESVAL  (8'h0)
+  ) u_buffer_control_cut_through_words (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (buffer_control_cut_through_words_we),
+    .wd     (buffer_control_cut_through_words_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.buffer_control.cut_through_words.q ),
+
+    // to register interface (read)
+    .qs     (buffer_control_cut_through_words_qs)
+  );
+
+
+  //   F[read_watermark]: 23:16
+  prim_subreg #(
+    .DW      (8),
+    .SWACCESS("RW"),
+    .RESVAL  (8'h0)
+  ) u_buffer_control_read_watermark (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (buffer_control_read_watermark_we),
+    .wd     (buffer_control_read_watermark_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.buffer_control.read_watermark.q ),
+
+    // to register interface (read)
+    .qs     (buffer_control_read_watermark_qs)
+  );
+
+
+  //   F[write_watermark]: 31:24
+  prim_subreg #(
+    .DW      (8),
+    .SWACCESS("RW"),
+    .RESVAL  (8'h0)
+  ) u_buffer_control_write_watermark (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (buffer_control_write_watermark_we),
+    .wd     (buffer_control_write_watermark_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.buffer_control.write_watermark.q ),
+
+    // to register interface (read)
+    .qs     (buffer_control_write_watermark_qs)
+  );
+
+
+  // R[slot_interrupt_status]: V(True)
+
+  //   F[interrupt_signal_for_each_slot]: 7:0
+  prim_subreg_ext #(
+    .DW    (8)
+  ) u_slot_interrupt_status_interrupt_signal_for_each_slot (
+    .re     (slot_interrupt_status_interrupt_signal_for_each_slot_re),
+    .we     (1'b0),
+    .wd     ('0),
+    .d      (hw2reg.slot_interrupt_status.interrupt_signal_for_each_slot.d),
+    .qre    (),
+    .qe     (),
+    .q      (),
     .qs     (slot_interrupt_status_interrupt_signal_for_each_slot_qs)
   );
 
@@ -3736,7 +4419,7 @@ module sdhci_reg_top #(
 
   //   F[specification_version_number]: 23:16
   // constant-only read
-  assign host_controller_version_specification_version_number_qs = 8'h0;
+  assign host_controller_version_specification_version_number_qs = 8'h1;
 
 
   //   F[vendor_version_number]: 31:24
@@ -3746,7 +4429,7 @@ module sdhci_reg_top #(
 
 
 
-  logic [31:0] addr_hit;
+  logic [39:0] addr_hit;
   always_comb begin
     addr_hit = '0;
     addr_hit[ 0] = reg_addr == SDHCI_SYSTEM_ADDRESS_OFFSET;
@@ -3775,12 +4458,20 @@ module sdhci_reg_top #(
     addr_hit[23] = reg_addr == SDHCI_NORMAL_INTERRUPT_SIGNAL_ENABLE_OFFSET;
     addr_hit[24] = reg_addr == SDHCI_ERROR_INTERRUPT_SIGNAL_ENABLE_OFFSET;
     addr_hit[25] = reg_addr == SDHCI_AUTO_CMD12_ERROR_STATUS_OFFSET;
-    addr_hit[26] = reg_addr == SDHCI_CAPABILITIES_OFFSET;
-    addr_hit[27] = reg_addr == SDHCI_CAPABILITIES_RESERVED_OFFSET;
-    addr_hit[28] = reg_addr == SDHCI_MAXIMUM_CURRENT_CAPABILITIES_OFFSET;
-    addr_hit[29] = reg_addr == SDHCI_MAXIMUM_CURRENT_CAPABILITIES_RESERVED_OFFSET;
-    addr_hit[30] = reg_addr == SDHCI_SLOT_INTERRUPT_STATUS_OFFSET;
-    addr_hit[31] = reg_addr == SDHCI_HOST_CONTROLLER_VERSION_OFFSET;
+    addr_hit[26] = reg_addr == SDHCI_HOST_CONTROL_2_OFFSET;
+    addr_hit[27] = reg_addr == SDHCI_CAPABILITIES_OFFSET;
+    addr_hit[28] = reg_addr == SDHCI_CAPABILITIES_RESERVED_OFFSET;
+    addr_hit[29] = reg_addr == SDHCI_MAXIMUM_CURRENT_CAPABILITIES_OFFSET;
+    addr_hit[30] = reg_addr == SDHCI_MAXIMUM_CURRENT_CAPABILITIES_RESERVED_OFFSET;
+    addr_hit[31] = reg_addr == SDHCI_ADMA_ERROR_STATUS_OFFSET;
+    addr_hit[32] = reg_addr == SDHCI_ADMA_SYSTEM_ADDRESS_OFFSET;
+    addr_hit[33] = reg_addr == SDHCI_ADMA_SYSTEM_ADDRESS_UPPER_OFFSET;
+    addr_hit[34] = reg_addr == SDHCI_COMMAND_QUEUE_STATUS_OFFSET;
+    addr_hit[35] = reg_addr == SDHCI_BUFFER_DATA_WINDOW_OFFSET;
+    addr_hit[36] = reg_addr == SDHCI_INTERRUPT_COALESCING_OFFSET;
+    addr_hit[37] = reg_addr == SDHCI_BUFFER_CONTROL_OFFSET;
+    addr_hit[38] = reg_addr == SDHCI_SLOT_INTERRUPT_STATUS_OFFSET;
+    addr_hit[39] = reg_addr == SDHCI_HOST_CONTROLLER_VERSION_OFFSET;
   end
 
   assign addrmiss = (reg_re || reg_we) ? ~|addr_hit : 1'b0 ;
@@ -3819,7 +4510,15 @@ module sdhci_reg_top #(
                (addr_hit[28] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[28]))) |
                (addr_hit[29] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[29]))) |
                (addr_hit[30] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[30]))) |
-               (addr_hit[31] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[31])))));
+               (addr_hit[31] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[31]))) |
+               (addr_hit[32] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[32]))) |
+               (addr_hit[33] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[33]))) |
+               (addr_hit[34] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[34]))) |
+               (addr_hit[35] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[35]))) |
+               (addr_hit[36] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[36]))) |
+               (addr_hit[37] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[37]))) |
+               (addr_hit[38] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[38]))) |
+               (addr_hit[39] & (|((reg_be ^ (reg_be >> 1)) & SDHCI_DISALLOWED_BOUNDARY_CROSSINGS[39])))));
   end
 
   assign system_address_we = addr_hit[0] & reg_we & !reg_error & (|(4'b 1111 & reg_be));
@@ -3854,7 +4553,9 @@ module sdhci_reg_top #(
   assign transfer_mode_auto_cmd12_enable_wd = reg_wdata[2];
   assign transfer_mode_auto_cmd12_enable_re = addr_hit[4] & reg_re & !reg_error;
 
-  assign transfer_mode_rsvd_3_re = addr_hit[4] & reg_re & !reg_error;
+  assign transfer_mode_auto_cmd23_enable_we = addr_hit[4] & reg_we & !reg_error & (|(4'b 0001 & reg_be));
+  assign transfer_mode_auto_cmd23_enable_wd = reg_wdata[3];
+  assign transfer_mode_auto_cmd23_enable_re = addr_hit[4] & reg_re & !reg_error;
 
   assign transfer_mode_data_transfer_direction_select_we = addr_hit[4] & reg_we & !reg_error & (|(4'b 0001 & reg_be));
   assign transfer_mode_data_transfer_direction_select_wd = reg_wdata[4];
@@ -3899,6 +4600,12 @@ module sdhci_reg_top #(
   assign host_control_high_speed_enable_we = addr_hit[12] & reg_we & !reg_error & (|(4'b 0001 & reg_be));
   assign host_control_high_speed_enable_wd = reg_wdata[2];
 
+  assign host_control_dma_select_we = addr_hit[12] & reg_we & !reg_error & (|(4'b 0001 & reg_be));
+  assign host_control_dma_select_wd = reg_wdata[4:3];
+
+  assign host_control_extended_data_transfer_width_we = addr_hit[12] & reg_we & !reg_error & (|(4'b 0001 & reg_be));
+  assign host_control_extended_data_transfer_width_wd = reg_wdata[5];
+
   assign power_control_sd_bus_power_we = addr_hit[13] & reg_we & !reg_error & (|(4'b 0010 & reg_be));
   assign power_control_sd_bus_power_wd = reg_wdata[8];
 
@@ -3932,6 +4639,9 @@ module sdhci_reg_top #(
   assign clock_control_sd_clock_enable_we = addr_hit[16] & reg_we & !reg_error & (|(4'b 0001 & reg_be));
   assign clock_control_sd_clock_enable_wd = reg_wdata[2];
 
+  assign clock_control_upper_bits_of_sdclk_frequency_select_we = addr_hit[16] & reg_we & !reg_error & (|(4'b 0001 & reg_be));
+  assign clock_control_upper_bits_of_sdclk_frequency_select_wd = reg_wdata[7:6];
+
   assign clock_control_sdclk_frequency_select_we = addr_hit[16] & reg_we & !reg_error & (|(4'b 0010 & reg_be));
   assign clock_control_sdclk_frequency_select_wd = reg_wdata[15:8];
 
@@ -3998,6 +4708,9 @@ module sdhci_reg_top #(
   assign error_interrupt_status_auto_cmd12_error_we = addr_hit[20] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
   assign error_interrupt_status_auto_cmd12_error_wd = reg_wdata[24];
 
+  assign error_interrupt_status_adma_error_we = addr_hit[20] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
+  assign error_interrupt_status_adma_error_wd = reg_wdata[25];
+
   assign error_interrupt_status_vendor_specific_error_we = addr_hit[20] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
   assign error_interrupt_status_vendor_specific_error_wd = reg_wdata[31:28];
 
@@ -4055,6 +4768,9 @@ module sdhci_reg_top #(
   assign error_interrupt_status_enable_auto_cmd12_error_status_enable_we = addr_hit[22] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
   assign error_interrupt_status_enable_auto_cmd12_error_status_enable_wd = reg_wdata[24];
 
+  assign error_interrupt_status_enable_adma_error_status_enable_we = addr_hit[22] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
+  assign error_interrupt_status_enable_adma_error_status_enable_wd = reg_wdata[25];
+
   assign error_interrupt_status_enable_vendor_specific_error_status_enable_we = addr_hit[22] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
   assign error_interrupt_status_enable_vendor_specific_error_status_enable_wd = reg_wdata[31:28];
 
@@ -4112,12 +4828,55 @@ module sdhci_reg_top #(
   assign error_interrupt_signal_enable_auto_cmd12_error_signal_enable_we = addr_hit[24] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
   assign error_interrupt_signal_enable_auto_cmd12_error_signal_enable_wd = reg_wdata[24];
 
+  assign error_interrupt_signal_enable_adma_error_signal_enable_we = addr_hit[24] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
+  assign error_interrupt_signal_enable_adma_error_signal_enable_wd = reg_wdata[25];
+
   assign error_interrupt_signal_enable_vendor_specific_error_signal_enable_we = addr_hit[24] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
   assign error_interrupt_signal_enable_vendor_specific_error_signal_enable_wd = reg_wdata[31:28];
 
-  assign slot_interrupt_status_interrupt_signal_for_each_slot_re = addr_hit[30] & reg_re & !reg_error;
+  assign host_control_2_uhs_mode_select_we = addr_hit[26] & reg_we & !reg_error & (|(4'b 0100 & reg_be));
+  assign host_control_2_uhs_mode_select_wd = reg_wdata[18:16];
+
+  assign host_control_2_signaling_1_8v_enable_we = addr_hit[26] & reg_we & !reg_error & (|(4'b 0100 & reg_be));
+  assign host_control_2_signaling_1_8v_enable_wd = reg_wdata[19];
+
+  assign host_control_2_execute_tuning_we = addr_hit[26] & reg_we & !reg_error & (|(4'b 0100 & reg_be));
+  assign host_control_2_execute_tuning_wd = reg_wdata[22];
+
+  assign host_control_2_sampling_clock_select_we = addr_hit[26] & reg_we & !reg_error & (|(4'b 0100 & reg_be));
+  assign host_control_2_sampling_clock_select_wd = reg_wdata[23];
+
+  assign adma_system_address_we = addr_hit[32] & reg_we & !reg_error & (|(4'b 1111 & reg_be));
+  assign adma_system_address_wd = reg_wdata[31:0];
+
+  assign adma_system_address_upper_we = addr_hit[33] & reg_we & !reg_error & (|(4'b 1111 & reg_be));
+  assign adma_system_address_upper_wd = reg_wdata[31:0];
 
-  assign slot_interrupt_status_rsvd_8_re = addr_hit[30] & reg_re & !reg_error;
+  assign command_queue_status_re = addr_hit[34] & reg_re & !reg_error;
+
+  assign buffer_data_window_re = addr_hit[35] & reg_re & !reg_error;
+
+  assign interrupt_coalescing_event_threshold_we = addr_hit[36] & reg_we & !reg_error & (|(4'b 0001 & reg_be));
+  assign interrupt_coalescing_event_threshold_wd = reg_wdata[7:0];
+
+  assign interrupt_coalescing_timeout_we = addr_hit[36] & reg_we & !reg_error & (|(4'b 1100 & reg_be));
+  assign interrupt_coalescing_timeout_wd = reg_wdata[31:16];
+
+  assign buffer_control_write_prefill_we = addr_hit[37] & reg_we & !reg_error & (|(4'b 0001 & reg_be));
+  assign buffer_control_write_prefill_wd = reg_wdata[0];
+
+  assign buffer_control_cut_through_words_we = addr_hit[37] & reg_we & !reg_error & (|(4'b 0010 & reg_be));
+  assign buffer_control_cut_through_words_wd = reg_wdata[15:8];
+
+  assign buffer_control_read_watermark_we = addr_hit[37] & reg_we & !reg_error & (|(4'b 0100 & reg_be));
+  assign buffer_control_read_watermark_wd = reg_wdata[23:16];
+
+  assign buffer_control_write_watermark_we = addr_hit[37] & reg_we & !reg_error & (|(4'b 1000 & reg_be));
+  assign buffer_control_write_watermark_wd = reg_wdata[31:24];
+
+  assign slot_interrupt_status_interrupt_signal_for_each_slot_re = addr_hit[38] & reg_re & !reg_error;
+
+  assign slot_interrupt_status_rsvd_8_re = addr_hit[38] & reg_re & !reg_error;
 
   // Read data return
   always_comb begin
@@ -4144,7 +4903,7 @@ module sdhci_reg_top #(
         reg_rdata_next[0] = transfer_mode_dma_enable_qs;
         reg_rdata_next[1] = transfer_mode_block_count_enable_qs;
         reg_rdata_next[2] = transfer_mode_auto_cmd12_enable_qs;
-        reg_rdata_next[3] = transfer_mode_rsvd_3_qs;
+        reg_rdata_next[3] = transfer_mode_auto_cmd23_enable_qs;
         reg_rdata_next[4] = transfer_mode_data_transfer_direction_select_qs;
         reg_rdata_next[5] = transfer_mode_multi_single_block_select_qs;
         reg_rdata_next[7:6] = transfer_mode_rsvd_6_qs;
@@ -4205,7 +4964,9 @@ module sdhci_reg_top #(
         reg_rdata_next[0] = host_control_led_control_qs;
         reg_rdata_next[1] = host_control_data_transfer_width_qs;
         reg_rdata_next[2] = host_control_high_speed_enable_qs;
-        reg_rdata_next[7:3] = host_control_rsvd_3_qs;
+        reg_rdata_next[4:3] = host_control_dma_select_qs;
+        reg_rdata_next[5] = host_control_extended_data_transfer_width_qs;
+        reg_rdata_next[7:6] = host_control_rsvd_6_qs;
     end
 
     if (addr_hit[13]) begin
@@ -4233,7 +4994,8 @@ module sdhci_reg_top #(
         reg_rdata_next[0] = clock_control_internal_clock_enable_qs;
         reg_rdata_next[1] = clock_control_internal_clock_stable_qs;
         reg_rdata_next[2] = clock_control_sd_clock_enable_qs;
-        reg_rdata_next[7:3] = clock_control_rsvd_3_qs;
+        reg_rdata_next[5:3] = clock_control_rsvd_3_qs;
+        reg_rdata_next[7:6] = clock_control_upper_bits_of_sdclk_frequency_select_qs;
         reg_rdata_next[15:8] = clock_control_sdclk_frequency_select_qs;
     end
 
@@ -4273,7 +5035,8 @@ module sdhci_reg_top #(
         reg_rdata_next[22] = error_interrupt_status_data_end_bit_error_qs;
         reg_rdata_next[23] = error_interrupt_status_current_limit_error_qs;
         reg_rdata_next[24] = error_interrupt_status_auto_cmd12_error_qs;
-        reg_rdata_next[27:25] = error_interrupt_status_rsvd_9_qs;
+        reg_rdata_next[25] = error_interrupt_status_adma_error_qs;
+        reg_rdata_next[27:26] = error_interrupt_status_rsvd_10_qs;
         reg_rdata_next[31:28] = error_interrupt_status_vendor_specific_error_qs;
     end
 
@@ -4301,7 +5064,8 @@ module sdhci_reg_top #(
         reg_rdata_next[22] = error_interrupt_status_enable_data_end_bit_error_status_enable_qs;
         reg_rdata_next[23] = error_interrupt_status_enable_current_limit_error_status_enable_qs;
         reg_rdata_next[24] = error_interrupt_status_enable_auto_cmd12_error_status_enable_qs;
-        reg_rdata_next[27:25] = error_interrupt_status_enable_rsvd_9_qs;
+        reg_rdata_next[25] = error_interrupt_status_enable_adma_error_status_enable_qs;
+        reg_rdata_next[27:26] = error_interrupt_status_enable_rsvd_10_qs;
         reg_rdata_next[31:28] = error_interrupt_status_enable_vendor_specific_error_status_enable_qs;
     end
 
@@ -4329,7 +5093,8 @@ module sdhci_reg_top #(
         reg_rdata_next[22] = error_interrupt_signal_enable_data_end_bit_error_signal_enable_qs;
         reg_rdata_next[23] = error_interrupt_signal_enable_current_limit_error_signal_enable_qs;
         reg_rdata_next[24] = error_interrupt_signal_enable_auto_cmd12_error_signal_enable_qs;
-        reg_rdata_next[27:25] = error_interrupt_signal_enable_rsvd_9_qs;
+        reg_rdata_next[25] = error_interrupt_signal_enable_adma_error_signal_enable_qs;
+        reg_rdata_next[27:26] = error_interrupt_signal_enable_rsvd_10_qs;
         reg_rdata_next[31:28] = error_interrupt_signal_enable_vendor_specific_error_signal_enable_qs;
     end
 
@@ -4345,13 +5110,24 @@ module sdhci_reg_top #(
     end
 
     if (addr_hit[26]) begin
+        reg_rdata_next[18:16] = host_control_2_uhs_mode_select_qs;
+        reg_rdata_next[19] = host_control_2_signaling_1_8v_enable_qs;
+        reg_rdata_next[21:20] = host_control_2_rsvd_4_qs;
+        reg_rdata_next[22] = host_control_2_execute_tuning_qs;
+        reg_rdata_next[23] = host_control_2_sampling_clock_select_qs;
+        reg_rdata_next[31:24] = host_control_2_rsvd_8_qs;
+    end
+
+    if (addr_hit[27]) begin
         reg_rdata_next[5:0] = capabilities_timeout_clock_frequency_qs;
         reg_rdata_next[6] = capabilities_rsvd_6_qs;
         reg_rdata_next[7] = capabilities_timeout_clock_unit_qs;
         reg_rdata_next[13:8] = capabilities_base_clock_frequency_for_sd_clock_qs;
         reg_rdata_next[15:14] = capabilities_rsvd_14_qs;
         reg_rdata_next[17:16] = capabilities_max_block_length_qs;
-        reg_rdata_next[20:18] = capabilities_rsvd_18_qs;
+        reg_rdata_next[18] = capabilities_embedded_8bit_support_qs;
+        reg_rdata_next[19] = capabilities_adma2_support_qs;
+        reg_rdata_next[20] = capabilities_rsvd_20_qs;
         reg_rdata_next[21] = capabilities_high_speed_support_qs;
         reg_rdata_next[22] = capabilities_dma_support_qs;
         reg_rdata_next[23] = capabilities_suspend_resume_support_qs;
@@ -4361,27 +5137,66 @@ module sdhci_reg_top #(
         reg_rdata_next[31:27] = capabilities_rsvd_27_qs;
     end
 
-    if (addr_hit[27]) begin
-        reg_rdata_next[31:0] = capabilities_reserved_qs;
+    if (addr_hit[28]) begin
+        reg_rdata_next[0] = capabilities_reserved_sdr50_support_qs;
+        reg_rdata_next[1] = capabilities_reserved_sdr104_support_qs;
+        reg_rdata_next[2] = capabilities_reserved_ddr50_support_qs;
+        reg_rdata_next[12:3] = capabilities_reserved_rsvd_3_qs;
+        reg_rdata_next[13] = capabilities_reserved_use_tuning_for_sdr50_qs;
+        reg_rdata_next[31:14] = capabilities_reserved_rsvd_14_qs;
     end
 
-    if (addr_hit[28]) begin
+    if (addr_hit[29]) begin
         reg_rdata_next[7:0] = maximum_current_capabilities_maximum_current_for_3_3v_qs;
         reg_rdata_next[15:8] = maximum_current_capabilities_maximum_current_for_3_0v_qs;
         reg_rdata_next[23:16] = maximum_current_capabilities_maximum_current_for_1_8v_qs;
         reg_rdata_next[31:24] = maximum_current_capabilities_rsvd_24_qs;
     end
 
-    if (addr_hit[29]) begin
+    if (addr_hit[30]) begin
         reg_rdata_next[31:0] = maximum_current_capabilities_reserved_qs;
     end
 
-    if (addr_hit[30]) begin
+    if (addr_hit[31]) begin
+        reg_rdata_next[1:0] = adma_error_status_adma_error_state_qs;
+        reg_rdata_next[2] = adma_error_status_adma_length_mismatch_error_qs;
+        reg_rdata_next[31:3] = adma_error_status_rsvd_3_qs;
+    end
+
+    if (addr_hit[32]) begin
+        reg_rdata_next[31:0] = adma_system_address_qs;
+    end
+
+    if (addr_hit[33]) begin
+        reg_rdata_next[31:0] = adma_system_address_upper_qs;
+    end
+
+    if (addr_hit[34]) begin
+        reg_rdata_next[7:0] = command_queue_status_qs;
+    end
+
+    if (addr_hit[35]) begin
+        reg_rdata_next[7:0] = buffer_data_window_qs;
+    end
+
+    if (addr_hit[36]) begin
+        reg_rdata_next[7:0] = interrupt_coalescing_event_threshold_qs;
+        reg_rdata_next[31:16] = interrupt_coalescing_timeout_qs;
+    end
+
+    if (addr_hit[37]) begin
+        reg_rdata_next[0] = buffer_control_write_prefill_qs;
+        reg_rdata_next[15:8] = buffer_control_cut_through_words_qs;
+        reg_rdata_next[23:16] = buffer_control_read_watermark_qs;
+        reg_rdata_next[31:24] = buffer_control_write_watermark_qs;
+    end
+
+    if (addr_hit[38]) begin
         reg_rdata_next[7:0] = slot_interrupt_status_interrupt_signal_for_each_slot_qs;
         reg_rdata_next[15:8] = slot_interrupt_status_rsvd_8_qs;
     end
 
-    if (addr_hit[31]) begin
+    if (addr_hit[39]) begin
         reg_rdata_next[23:16] = host_controller_version_specification_version_number_qs;
         reg_rdata_next[31:24] = host_controller_version_vendor_version_number_qs;
     end
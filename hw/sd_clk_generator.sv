@@ -27,20 +27,25 @@ module sd_clk_generator #(
 
   output `writable_reg_t() sd_clk_stable_o
 );
-  localparam int unsigned MsbConsidered = (ClkPreDivLog != 0) ? (ClkPreDivLog - 1) : 0;
-  //check if all bits from [ClkPreDivLog-1:0] are one
-  function logic lsbones(input logic[ClkPreDivLog+7:0] div);
-    if(ClkPreDivLog == 0) return '1;
-    else return (div[MsbConsidered:0] == '1);
-  endfunction
-
-  logic[7:0] div_d, div_q;
-  assign div_d = (!reg2hw_i.clock_control.sd_clock_enable.q) ? reg2hw_i.clock_control.sdclk_frequency_select.q : div_q;
-  `FF(div_q, div_d, 8'b0, clk_i, rst_ni);
-
-  //counter
-  logic[ClkPreDivLog+7 :0]  cnt_d, cnt_q;
-  assign cnt_d = cnt_q + 1;
+  // 10-bit divided clock select, the sd clock runs at base / (2 * div), or at base for div 0
+  logic [9:0] div_d, div_q;
+  assign div_d = (!reg2hw_i.clock_control.sd_clock_enable.q) ?
+                 { reg2hw_i.clock_control.upper_bits_of_sdclk_frequency_select.q,
+                   reg2hw_i.clock_control.sdclk_frequency_select.q } : div_q;
+  `FF(div_q, div_d, '0, clk_i, rst_ni);
+
+  // base clock is clk_i / 2**ClkPreDivLog, count clk_i cycles per half sd clock period
+  localparam int unsigned CntWidth = ClkPreDivLog + 10;
+  logic [CntWidth-1:0] half_period_m1;
+  always_comb begin : half_period
+    if (div_q == '0) begin
+      half_period_m1 = (ClkPreDivLog != 0) ? CntWidth'((1 << ClkPreDivLog) >> 1) - 1 : '0;
+    end else begin
+      half_period_m1 = (CntWidth'(div_q) << ClkPreDivLog) - 1;
+    end
+  end
+
+  logic [CntWidth-1:0] cnt_d, cnt_q;
   `FF(cnt_q, cnt_d, '0, clk_i, rst_ni);
 
   logic clk_en_p_d, clk_en_p_q;
@@ -49,77 +54,32 @@ module sd_clk_generator #(
   logic clk_en_n_d, clk_en_n_q;
   `FF(clk_en_n_q, clk_en_n_d, '0, clk_i, rst_ni);
 
-  logic [ClkPreDivLog+7:0] bitmask;
-  assign bitmask = (1 << ClkPreDivLog) >> 1;
-
-  //clk source multiplexer
+  // the enables are computed a cycle ahead, so they are high right before clk_div_q toggles
   logic clk_div_d, clk_div_q, clk_o_ungated;
-  always_comb begin : clk_div_mux
-    clk_div_d   = 1'b1;
-    clk_en_p_d  = clk_en_p_q;
-    clk_en_n_d  = clk_en_n_q;
-
-    unique case (div_q)
-      8'h00:  begin
-        if (ClkPreDivLog != 0) begin 
-          clk_div_d  = cnt_q[MsbConsidered];
-          clk_en_p_d = lsbones(cnt_q ^ bitmask);
-          clk_en_n_d = lsbones(cnt_q);
-        end
-      end
-      8'h01:  begin 
-        clk_div_d = cnt_q[ClkPreDivLog];
-        clk_en_p_d  = (!cnt_q[ClkPreDivLog]) && lsbones(cnt_q);
-        clk_en_n_d  = cnt_q[ClkPreDivLog]    && lsbones(cnt_q);
-      end
-      8'h02:  begin
-        clk_div_d = cnt_q[ClkPreDivLog+1];
-        clk_en_p_d  = (cnt_q[ClkPreDivLog+1:ClkPreDivLog] == 2'b01) && lsbones(cnt_q);
-        clk_en_n_d  = (cnt_q[ClkPreDivLog+1:ClkPreDivLog] == 2'b11) && lsbones(cnt_q);
-      end
-      8'h04:  begin
-        clk_div_d = cnt_q[ClkPreDivLog+2];
-        clk_en_p_d  = (cnt_q[ClkPreDivLog+2:ClkPreDivLog] == 3'b011) && lsbones(cnt_q);   
-        clk_en_n_d  = (cnt_q[ClkPreDivLog+2:ClkPreDivLog] == 3'b111)  && lsbones(cnt_q);   
-      end
-      8'h08:  begin
-        clk_div_d = cnt_q[ClkPreDivLog+3];    
-        clk_en_p_d  = (cnt_q[ClkPreDivLog+3:ClkPreDivLog] == 4'b0111) && lsbones(cnt_q);
-        clk_en_n_d  = (cnt_q[ClkPreDivLog+3:ClkPreDivLog] == 4'b1111)  && lsbones(cnt_q);
-      end
-      8'h10:  begin
-        clk_div_d = cnt_q[ClkPreDivLog+4];
-        clk_en_p_d  = (cnt_q[ClkPreDivLog+4:ClkPreDivLog] == 5'b01111) && lsbones(cnt_q);
-        clk_en_n_d  = (cnt_q[ClkPreDivLog+4:ClkPreDivLog] == 5'b11111)  && lsbones(cnt_q);
-      end
-      8'h20:  begin
-        clk_div_d = cnt_q[ClkPreDivLog+5];
-        clk_en_p_d  = (cnt_q[ClkPreDivLog+5:ClkPreDivLog] == 6'b011111) && lsbones(cnt_q);
-        clk_en_n_d  = (cnt_q[ClkPreDivLog+5:ClkPreDivLog] == 6'b111111)  && lsbones(cnt_q);
-      end
-      8'h40:  begin
-        clk_div_d = cnt_q[ClkPreDivLog+6];
-        clk_en_p_d  = (cnt_q[ClkPreDivLog+6:ClkPreDivLog] == 7'b0111111) && lsbones(cnt_q);
-        clk_en_n_d  = (cnt_q[ClkPreDivLog+6:ClkPreDivLog] == 7'b1111111)  && lsbones(cnt_q);
-      end
-      8'h80:  begin
-        clk_div_d = cnt_q[ClkPreDivLog+7];
-        clk_en_p_d  = (cnt_q[ClkPreDivLog+7:ClkPreDivLog] == 8'b01111111) && lsbones(cnt_q);
-        clk_en_n_d  = (cnt_q[ClkPreDivLog+7:ClkPreDivLog] == 8'b11111111)  && lsbones(cnt_q);
-      end
-      
-      default: ;
-    endcase
+  always_comb begin : clk_div
+    cnt_d     = cnt_q + 1;
+    clk_div_d = clk_div_q;
+    // >= catches a counter left above a new, smaller divider
+    if (cnt_q >= half_period_m1) begin
+      cnt_d     = '0;
+      clk_div_d = !clk_div_q;
+    end
+
+    clk_en_p_d = (cnt_d >= half_period_m1) && !clk_div_d;
+    clk_en_n_d = (cnt_d >= half_period_m1) &&  clk_div_d;
   end
   `FF(clk_div_q, clk_div_d, 1'b1, clk_i, rst_ni);
-  
-  assign clk_o_ungated = ((div_q == 8'h00) && (ClkPreDivLog == 0)) ?  clk_i : clk_div_q;
-  assign clk_en_p_o    = ((div_q == 8'h00) && (ClkPreDivLog == 0)) ?  '1 : clk_en_p_q;
-  assign clk_en_n_o    = ((div_q == 8'h00) && (ClkPreDivLog == 0)) ?  '1 : clk_en_n_q;
+
+  logic div_1;
+  assign div_1 = (div_q == '0) && (ClkPreDivLog == 0);
+
+  assign clk_o_ungated = div_1 ?  clk_i : clk_div_q;
+  assign clk_en_p_o    = div_1 ?  '1 : clk_en_p_q;
+  assign clk_en_n_o    = div_1 ?  '1 : clk_en_n_q;
 
   assign sd_clk_o =  (reg2hw_i.clock_control.sd_clock_enable.q && !pause_sd_clk_i) ? clk_o_ungated : 1'b1;
 
-  assign div_1_o = ((div_q == 8'h00) && (ClkPreDivLog == 0));
+  assign div_1_o = div_1;
   assign sd_clk_stable_o = '{ de: '1, d: reg2hw_i.clock_control.internal_clock_enable.q};
 
 
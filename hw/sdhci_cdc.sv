@@ -0,0 +1,185 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+/**
+ * Clock domain crossing between the system bus and a controller running on sd_base_clk_i
+ * The register bus goes through reg_cdc, the dma port through a request and a response
+ * cdc_2phase and the interrupt through a synchronizer. The dma engine only has one word in
+ * flight, so a new request is only passed on after the response of the previous one came back.
+ * With `Bypass` everything is wired through and the controller runs on clk_i.
+ */
+
+`include "common_cells/registers.svh"
+
+module sdhci_cdc #(
+  parameter bit  Bypass    = 1'b1,
+  parameter type reg_req_t = logic,
+  parameter type reg_rsp_t = logic
+) (
+  // System side
+  input  logic clk_i,
+  input  logic rst_ni,
+
+  input  reg_req_t reg_req_i,
+  output reg_rsp_t reg_rsp_o,
+
+  output logic        dma_req_o,
+  input  logic        dma_gnt_i,
+  output logic [31:0] dma_addr_o,
+  output logic        dma_we_o,
+  output logic [3:0]  dma_be_o,
+  output logic [31:0] dma_wdata_o,
+  input  logic        dma_rvalid_i,
+  input  logic [31:0] dma_rdata_i,
+  input  logic        dma_err_i,
+
+  output logic interrupt_o,
+
+  // Controller side
+  input  logic sd_base_clk_i,
+  output logic core_clk_o,
+  output logic core_rst_no,
+
+  output reg_req_t core_reg_req_o,
+  input  reg_rsp_t core_reg_rsp_i,
+
+  input  logic        core_dma_req_i,
+  output logic        core_dma_gnt_o,
+  input  logic [31:0] core_dma_addr_i,
+  input  logic        core_dma_we_i,
+  input  logic [3:0]  core_dma_be_i,
+  input  logic [31:0] core_dma_wdata_i,
+  output logic        core_dma_rvalid_o,
+  output logic [31:0] core_dma_rdata_o,
+  output logic        core_dma_err_o,
+
+  input  logic core_interrupt_i
+);
+
+  if (Bypass) begin : gen_bypass
+    assign core_clk_o     = clk_i;
+    assign core_rst_no    = rst_ni;
+    assign core_reg_req_o = reg_req_i;
+    assign reg_rsp_o      = core_reg_rsp_i;
+
+    assign dma_req_o         = core_dma_req_i;
+    assign core_dma_gnt_o    = dma_gnt_i;
+    assign dma_addr_o        = core_dma_addr_i;
+    assign dma_we_o          = core_dma_we_i;
+    assign dma_be_o          = core_dma_be_i;
+    assign dma_wdata_o       = core_dma_wdata_i;
+    assign core_dma_rvalid_o = dma_rvalid_i;
+    assign core_dma_rdata_o  = dma_rdata_i;
+    assign core_dma_err_o    = dma_err_i;
+
+    assign interrupt_o = core_interrupt_i;
+  end else begin : gen_cdc
+    typedef struct packed {
+      logic [31:0] addr;
+      logic        we;
+      logic [3:0]  be;
+      logic [31:0] wdata;
+    } dma_req_t;
+
+    typedef struct packed {
+      logic [31:0] rdata;
+      logic        err;
+    } dma_rsp_t;
+
+    logic core_rst_n;
+    assign core_clk_o  = sd_base_clk_i;
+    assign core_rst_no = core_rst_n;
+
+    rstgen i_rstgen (
+      .clk_i       (sd_base_clk_i),
+      .rst_ni,
+      .test_mode_i (1'b0),
+      .rst_no      (core_rst_n),
+      .init_no     ()
+    );
+
+    reg_cdc #(
+      .req_t (reg_req_t),
+      .rsp_t (reg_rsp_t)
+    ) i_reg_cdc (
+      .src_clk_i  (clk_i),
+      .src_rst_ni (rst_ni),
+      .src_req_i  (reg_req_i),
+      .src_rsp_o  (reg_rsp_o),
+
+      .dst_clk_i  (sd_base_clk_i),
+      .dst_rst_ni (core_rst_n),
+      .dst_req_o  (core_reg_req_o),
+      .dst_rsp_i  (core_reg_rsp_i)
+    );
+
+    // Set from the grant until the response is back
+    logic dma_pending_q, dma_pending_d;
+    `FF(dma_pending_q, dma_pending_d, '0, sd_base_clk_i, core_rst_n);
+
+    logic dma_req_valid, dma_req_ready;
+    assign dma_req_valid  = core_dma_req_i && !dma_pending_q;
+    assign core_dma_gnt_o = dma_req_valid && dma_req_ready;
+    assign dma_pending_d  = (dma_pending_q || core_dma_gnt_o) && !core_dma_rvalid_o;
+
+    dma_req_t dma_req;
+
+    cdc_2phase #(
+      .T (dma_req_t)
+    ) i_dma_req_cdc (
+      .src_rst_ni  (core_rst_n),
+      .src_clk_i   (sd_base_clk_i),
+      .src_data_i  ('{ addr: core_dma_addr_i, we: core_dma_we_i, be: core_dma_be_i,
+                       wdata: core_dma_wdata_i }),
+      .src_valid_i (dma_req_valid),
+      .src_ready_o (dma_req_ready),
+
+      .dst_rst_ni  (rst_ni),
+      .dst_clk_i   (clk_i),
+      .dst_data_o  (dma_req),
+      .dst_valid_o (dma_req_o),
+      .dst_ready_i (dma_gnt_i)
+    );
+
+    assign dma_addr_o  = dma_req.addr;
+    assign dma_we_o    = dma_req.we;
+    assign dma_be_o    = dma_req.be;
+    assign dma_wdata_o = dma_req.wdata;
+
+    dma_rsp_t dma_rsp;
+
+    // Always ready, the response of the previous request was taken before this one was sent
+    cdc_2phase #(
+      .T (dma_rsp_t)
+    ) i_dma_rsp_cdc (
+      .src_rst_ni  (rst_ni),
+      .src_clk_i   (clk_i),
+      .src_data_i  ('{ rdata: dma_rdata_i, err: dma_err_i }),
+      .src_valid_i (dma_rvalid_i),
+      .src_ready_o (),
+
+      .dst_rst_ni  (core_rst_n),
+      .dst_clk_i   (sd_base_clk_i),
+      .dst_data_o  (dma_rsp),
+      .dst_valid_o (core_dma_rvalid_o),
+      .dst_ready_i (1'b1)
+    );
+
+    assign core_dma_rdata_o = dma_rsp.rdata;
+    assign core_dma_err_o   = dma_rsp.err;
+
+    sync #(
+      .STAGES (2)
+    ) i_interrupt_sync (
+      .clk_i,
+      .rst_ni,
+      .serial_i (core_interrupt_i),
+      .serial_o (interrupt_o)
+    );
+  end
+
+endmodule
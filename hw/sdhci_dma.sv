@@ -0,0 +1,408 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+/**
+ * SDMA and ADMA2 engine
+ * Moves whole blocks between the data buffer and system memory.
+ * A block is only started once the buffer signals buffer_read_enable / buffer_write_enable,
+ * so the buffer sees exactly the same access pattern as a PIO driver would produce.
+ *
+ * SDMA starts at `system_address`. When the address crosses a `host_dma_buffer_boundary` the engine
+ * stops and raises a dma interrupt, it continues once software writes a new `system_address`.
+ *
+ * ADMA2 walks the descriptor table at `adma_system_address`. The next descriptor is fetched as soon
+ * as the current one is used up, so the fetch overlaps with the card filling / draining the buffer.
+ * 64-bit descriptors are supported, but the upper half of every address has to be zero.
+ *
+ * System memory must be word aligned, a block size that is not a multiple of 4 only writes the
+ * valid bytes of the last word.
+ */
+
+`include "common_cells/registers.svh"
+`include "defines.svh"
+
+module sdhci_dma #(
+  parameter int unsigned MaxBlockBitSize = 10
+) (
+  input  logic clk_i,
+  input  logic rst_ni,
+
+  input  sdhci_reg_pkg::sdhci_reg2hw_t reg2hw_i,
+
+  input  logic read_operation_i,
+  input  logic write_operation_i,
+
+  // buffer side
+  input  logic        buffer_read_enable_i,
+  input  logic        buffer_write_enable_i,
+  output logic        buffer_pop_o,
+  input  logic [31:0] buffer_pop_data_i,
+  output logic        buffer_push_o,
+  output logic [31:0] buffer_push_data_o,
+
+  // memory side
+  output logic        mem_req_o,
+  input  logic        mem_gnt_i,
+  output logic [31:0] mem_addr_o,
+  output logic        mem_we_o,
+  output logic [3:0]  mem_be_o,
+  output logic [31:0] mem_wdata_o,
+  input  logic        mem_rvalid_i,
+  input  logic [31:0] mem_rdata_i,
+  input  logic        mem_err_i,
+
+  output logic busy_o,
+
+  output `writable_reg_t([31:0]) system_address_o,
+  output `writable_reg_t()       dma_interrupt_o,
+  output `writable_reg_t([3:0])  dma_error_o,
+
+  output `writable_reg_t([31:0]) adma_system_address_o,
+  output `writable_reg_t()       adma_error_o,
+  output sdhci_reg_pkg::sdhci_hw2reg_adma_error_status_reg_t adma_error_status_o
+);
+  typedef enum logic [3:0] {
+    IDLE,
+    FETCH_REQUEST,
+    FETCH_RESPONSE,
+    DECODE,
+    WAIT_FOR_BUFFER,
+    POP,
+    REQUEST,
+    RESPONSE,
+    BOUNDARY,
+    RESUME,
+    DONE
+  } dma_state_e;
+
+  // ADMA2 descriptor attributes
+  localparam int unsigned AttrValid = 0;
+  localparam int unsigned AttrEnd   = 1;
+  localparam int unsigned AttrInt   = 2;
+
+  typedef enum logic [1:0] {
+    ACT_NOP  = 2'b00,
+    ACT_RSV  = 2'b01,
+    ACT_TRAN = 2'b10,
+    ACT_LINK = 2'b11
+  } adma_act_e;
+
+  // Value of adma_error_state
+  typedef enum logic [1:0] {
+    ST_STOP = 2'b00,
+    ST_FDS  = 2'b01,
+    ST_TFR  = 2'b11
+  } adma_error_state_e;
+
+  dma_state_e state_q, state_d;
+  `FF(state_q, state_d, IDLE, clk_i, rst_ni);
+
+  logic enabled;
+  assign enabled = reg2hw_i.transfer_mode.dma_enable.q && (read_operation_i || write_operation_i);
+
+  // dma_select is only sampled at the start of a transfer
+  logic adma_q, adma_d, adma64_q, adma64_d;
+  `FF(adma_q,   adma_d,   '0, clk_i, rst_ni);
+  `FF(adma64_q, adma64_d, '0, clk_i, rst_ni);
+
+  logic [31:0] addr_q, addr_d;
+  `FF(addr_q, addr_d, '0, clk_i, rst_ni);
+
+  logic [31:0] data_q, data_d;
+  `FF(data_q, data_d, '0, clk_i, rst_ni);
+
+  logic [15:0] blocks_left_q, blocks_left_d;
+  `FF(blocks_left_q, blocks_left_d, '0, clk_i, rst_ni);
+
+  logic open_ended;
+  assign open_ended = reg2hw_i.transfer_mode.multi_single_block_select.q &&
+                      !reg2hw_i.transfer_mode.block_count_enable.q;
+
+  logic [MaxBlockBitSize-1:0] block_size;
+  assign block_size = MaxBlockBitSize'(reg2hw_i.block_size.transfer_block_size.q);
+
+  logic [MaxBlockBitSize-1:0] word_counter_q, word_counter_d;
+  `FF(word_counter_q, word_counter_d, '0, clk_i, rst_ni);
+
+  // Descriptor table pointer and the descriptor that is currently being fetched / executed
+  logic [31:0] desc_ptr_q, desc_ptr_d;
+  `FF(desc_ptr_q, desc_ptr_d, '0, clk_i, rst_ni);
+
+  logic [1:0] desc_word_q, desc_word_d;
+  `FF(desc_word_q, desc_word_d, '0, clk_i, rst_ni);
+
+  logic [2:0][31:0] desc_q, desc_d;
+  `FF(desc_q, desc_d, '0, clk_i, rst_ni);
+
+  // Bytes left in the current transfer descriptor, a length of 0 means 64K
+  logic [16:0] desc_bytes_left_q, desc_bytes_left_d;
+  `FF(desc_bytes_left_q, desc_bytes_left_d, '0, clk_i, rst_ni);
+
+  logic [15:0] desc_attr, desc_length;
+  logic [31:0] desc_address;
+  adma_act_e   desc_act;
+  assign {desc_length, desc_attr} = desc_q[0];
+  assign desc_address = desc_q[1];
+  assign desc_act     = adma_act_e'(desc_attr[5:4]);
+
+  logic [1:0] desc_last_word;
+  assign desc_last_word = adma64_q ? 2'd2 : 2'd1;
+
+  logic [31:0] desc_ptr_next;
+  assign desc_ptr_next = desc_ptr_q + (adma64_q ? 32'd12 : 32'd8);
+
+  logic last_word;
+  assign last_word = word_counter_q == (block_size + 3) / 4 - 1;
+
+  // Bytes of the current word that belong to the block
+  logic [2:0] word_bytes;
+  assign word_bytes = (last_word && block_size[1:0] != '0) ? {1'b0, block_size[1:0]} : 3'd4;
+
+  logic [31:0] addr_next;
+  assign addr_next = addr_q + 32'(word_bytes);
+
+  logic [16:0] desc_bytes_left_next;
+  assign desc_bytes_left_next = desc_bytes_left_q - 17'(word_bytes);
+
+  // Buffer boundary is 4K << host_dma_buffer_boundary
+  logic [31:0] boundary_mask;
+  assign boundary_mask = (32'h1000 << reg2hw_i.block_size.host_dma_buffer_boundary.q) - 1;
+
+  logic buffer_ready;
+  assign buffer_ready = read_operation_i ? buffer_read_enable_i : buffer_write_enable_i;
+
+  logic fetching;
+  assign fetching = state_q inside {FETCH_REQUEST, FETCH_RESPONSE};
+
+  logic              adma_error, adma_length_mismatch;
+  adma_error_state_e adma_error_state;
+
+  always_comb begin : dma_fsm
+    state_d           = state_q;
+    adma_d            = adma_q;
+    adma64_d          = adma64_q;
+    addr_d            = addr_q;
+    data_d            = data_q;
+    blocks_left_d     = blocks_left_q;
+    word_counter_d    = word_counter_q;
+    desc_ptr_d        = desc_ptr_q;
+    desc_word_d       = desc_word_q;
+    desc_d            = desc_q;
+    desc_bytes_left_d = desc_bytes_left_q;
+
+    buffer_pop_o       = '0;
+    buffer_push_o      = '0;
+    buffer_push_data_o = mem_rdata_i;
+
+    system_address_o      = '{ de: '0, d: addr_next };
+    dma_interrupt_o       = '{ de: '0, d: '1 };
+    dma_error_o           = '{ de: '0, d: 4'b0001 };
+    adma_system_address_o = '{ de: '0, d: desc_ptr_next };
+
+    adma_error           = '0;
+    adma_error_state     = ST_STOP;
+    adma_length_mismatch = '0;
+
+    if (!enabled) begin
+      state_d = IDLE;
+    end else begin
+      unique case (state_q)
+        IDLE: begin
+          adma_d         = reg2hw_i.host_control.dma_select.q[1];
+          adma64_d       = reg2hw_i.host_control.dma_select.q[0];
+          addr_d         = reg2hw_i.system_address.q;
+          desc_ptr_d     = reg2hw_i.adma_system_address.q;
+          desc_word_d    = '0;
+          word_counter_d = '0;
+          blocks_left_d  = reg2hw_i.transfer_mode.multi_single_block_select.q ? reg2hw_i.block_count.q : 16'd1;
+          if (open_ended) begin
+            // Never reaches the last block, dat_wrap ends the transfer
+            blocks_left_d = '1;
+          end
+
+          if (!reg2hw_i.host_control.dma_select.q[1]) begin
+            state_d = WAIT_FOR_BUFFER;
+          end else if (reg2hw_i.host_control.dma_select.q[0] &&
+                       reg2hw_i.adma_system_address_upper.q != '0) begin
+            // Only 32 bit addresses are supported
+            adma_error = '1;
+            state_d    = DONE;
+          end else begin
+            state_d = FETCH_REQUEST;
+          end
+        end
+        FETCH_REQUEST: begin
+          if (mem_gnt_i) begin
+            state_d = FETCH_RESPONSE;
+          end
+        end
+        FETCH_RESPONSE: begin
+          if (mem_rvalid_i) begin
+            desc_d[desc_word_q] = mem_rdata_i;
+
+            if (mem_err_i) begin
+              adma_error           = '1;
+              adma_error_state     = ST_FDS;
+              state_d              = DONE;
+            end else if (desc_word_q == desc_last_word) begin
+              desc_word_d = '0;
+              state_d     = DECODE;
+            end else begin
+              desc_word_d = desc_word_q + 1;
+              state_d     = FETCH_REQUEST;
+            end
+          end
+        end
+        DECODE: begin
+          if (!desc_attr[AttrValid] || (adma64_q && desc_q[2] != '0)) begin
+            adma_error           = '1;
+            adma_error_state     = ST_FDS;
+            state_d              = DONE;
+          end else begin
+            desc_ptr_d               = desc_ptr_next;
+            adma_system_address_o.de = '1;
+
+            unique case (desc_act)
+              ACT_TRAN: begin
+                addr_d            = desc_address;
+                desc_bytes_left_d = (desc_length == '0) ? 17'h10000 : 17'(desc_length);
+                if (word_counter_q == '0) begin
+                  state_d = WAIT_FOR_BUFFER;
+                end else begin
+                  state_d = read_operation_i ? POP : REQUEST;
+                end
+              end
+              ACT_LINK: begin
+                desc_ptr_d              = desc_address;
+                adma_system_address_o.d = desc_address;
+                dma_interrupt_o.de      = desc_attr[AttrInt];
+                state_d                 = FETCH_REQUEST;
+              end
+              default: begin // ACT_NOP, ACT_RSV
+                dma_interrupt_o.de = desc_attr[AttrInt];
+                if (desc_attr[AttrEnd]) begin
+                  // The descriptor table ended before the last block
+                  adma_error           = '1;
+                  adma_error_state     = ST_FDS;
+                  adma_length_mismatch = '1;
+                  state_d              = DONE;
+                end else begin
+                  state_d = FETCH_REQUEST;
+                end
+              end
+            endcase
+          end
+        end
+        WAIT_FOR_BUFFER: begin
+          if (blocks_left_q == '0) begin
+            state_d = DONE;
+          end else if (buffer_ready) begin
+            state_d = read_operation_i ? POP : REQUEST;
+          end
+        end
+        POP: begin
+          buffer_pop_o = '1;
+          data_d       = buffer_pop_data_i;
+          state_d      = REQUEST;
+        end
+        REQUEST: begin
+          if (mem_gnt_i) begin
+            state_d = RESPONSE;
+          end
+        end
+        RESPONSE: begin
+          if (mem_rvalid_i) begin
+            if (mem_err_i) begin
+              if (adma_q) begin
+                adma_error           = '1;
+                adma_error_state     = ST_TFR;
+              end else begin
+                dma_error_o.de = '1;
+              end
+              state_d = DONE;
+            end else begin
+              buffer_push_o = write_operation_i;
+
+              addr_d              = addr_next;
+              system_address_o.de = !adma_q;
+              desc_bytes_left_d   = desc_bytes_left_next;
+
+              if (last_word) begin
+                word_counter_d = '0;
+                blocks_left_d  = open_ended ? blocks_left_q : blocks_left_q - 1;
+              end else begin
+                word_counter_d = word_counter_q + 1;
+              end
+
+              if (last_word && blocks_left_q == 'b1) begin
+                if (adma_q && desc_bytes_left_next != '0) begin
+                  // The descriptor table describes more data than the transfer
+                  adma_error           = '1;
+                  adma_error_state     = ST_TFR;
+                  adma_length_mismatch = '1;
+                end else if (adma_q) begin
+                  dma_interrupt_o.de = desc_attr[AttrInt];
+                end
+                state_d = DONE;
+              end else if (adma_q && desc_bytes_left_next == '0) begin
+                dma_interrupt_o.de = desc_attr[AttrInt];
+                if (desc_attr[AttrEnd]) begin
+                  adma_error           = '1;
+                  adma_error_state     = ST_TFR;
+                  adma_length_mismatch = '1;
+                  state_d              = DONE;
+                end else begin
+                  state_d = FETCH_REQUEST;
+                end
+              end else if (!adma_q && (addr_next & boundary_mask) == '0) begin
+                dma_interrupt_o.de = '1;
+                state_d            = BOUNDARY;
+              end else if (last_word) begin
+                state_d = WAIT_FOR_BUFFER;
+              end else begin
+                state_d = read_operation_i ? POP : REQUEST;
+              end
+            end
+          end
+        end
+        BOUNDARY: begin
+          // Software writes the address of the next buffer to continue
+          if (reg2hw_i.system_address.qe) begin
+            state_d = RESUME;
+          end
+        end
+        RESUME: begin
+          addr_d = reg2hw_i.system_address.q;
+          if (word_counter_q == '0) begin
+            state_d = WAIT_FOR_BUFFER;
+          end else begin
+            state_d = read_operation_i ? POP : REQUEST;
+          end
+        end
+        DONE: ;
+        default: begin
+          state_d = IDLE;
+        end
+      endcase
+    end
+  end
+
+  assign adma_error_o        = '{ de: adma_error, d: '1 };
+  assign adma_error_status_o = '{
+    adma_error_state:           '{ de: adma_error, d: adma_error_state },
+    adma_length_mismatch_error: '{ de: adma_error, d: adma_length_mismatch }
+  };
+
+  // Waiting for a block that never comes is not busy, an open ended or suspended read ends there
+  assign busy_o = !(state_q inside {IDLE, WAIT_FOR_BUFFER, DONE});
+
+  assign mem_req_o   = state_q inside {REQUEST, FETCH_REQUEST};
+  assign mem_addr_o  = fetching ? desc_ptr_q + {28'b0, desc_word_q, 2'b00} : addr_q;
+  assign mem_we_o    = !fetching && read_operation_i;
+  assign mem_be_o    = (fetching || word_bytes == 3'd4) ? 4'b1111 : 4'((1 << word_bytes) - 1);
+  assign mem_wdata_o = data_q;
+endmodule
@@ -0,0 +1,126 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+/**
+ * AXI4 manager for the dma engine
+ * The engine only ever has one 32 bit word in flight, every request becomes a single beat
+ * AXI4 transaction. `gnt_o` is given once the address (and write data) were accepted,
+ * `rvalid_o` once the read data or the write response came back.
+ * On a 64 bit bus the word is placed in the lane selected by the address.
+ */
+
+`include "common_cells/registers.svh"
+
+module sdhci_dma_to_axi #(
+  parameter int unsigned AxiDataWidth = 32, // 32 or 64
+  parameter type         axi_req_t    = logic,
+  parameter type         axi_rsp_t    = logic
+) (
+  input  logic clk_i,
+  input  logic rst_ni,
+
+  input  logic        req_i,
+  output logic        gnt_o,
+  input  logic [31:0] addr_i,
+  input  logic        we_i,
+  input  logic [3:0]  be_i,
+  input  logic [31:0] wdata_i,
+  output logic        rvalid_o,
+  output logic [31:0] rdata_o,
+  output logic        err_o,
+
+  output axi_req_t axi_req_o,
+  input  axi_rsp_t axi_rsp_i
+);
+  localparam int unsigned NumLanes  = AxiDataWidth / 32;
+  localparam int unsigned LaneWidth = cf_math_pkg::idx_width(NumLanes);
+
+  typedef enum logic [1:0] {
+    IDLE,
+    READ_RESPONSE,
+    WRITE_RESPONSE
+  } state_e;
+
+  state_e state_q, state_d;
+  `FF(state_q, state_d, IDLE);
+
+  // AW and W may be accepted in different cycles
+  logic aw_done_q, aw_done_d, w_done_q, w_done_d;
+  `FF(aw_done_q, aw_done_d, '0);
+  `FF(w_done_q, w_done_d, '0);
+
+  logic [LaneWidth-1:0] lane, lane_q;
+  assign lane = LaneWidth'((addr_i >> 2) % NumLanes);
+  `FFL(lane_q, lane, gnt_o, '0);
+
+  always_comb begin
+    state_d   = state_q;
+    aw_done_d = aw_done_q;
+    w_done_d  = w_done_q;
+
+    axi_req_o = '0;
+
+    axi_req_o.aw.addr  = addr_i;
+    axi_req_o.aw.size  = axi_pkg::size_t'(2);
+    axi_req_o.aw.burst = axi_pkg::BURST_INCR;
+    axi_req_o.w.data   = {NumLanes{wdata_i}};
+    axi_req_o.w.strb   = (AxiDataWidth/8)'(be_i) << (lane * 4);
+    axi_req_o.w.last   = 1'b1;
+
+    axi_req_o.ar.addr  = addr_i;
+    axi_req_o.ar.size  = axi_pkg::size_t'(2);
+    axi_req_o.ar.burst = axi_pkg::BURST_INCR;
+
+    gnt_o    = '0;
+    rvalid_o = '0;
+    rdata_o  = axi_rsp_i.r.data[lane_q*32 +: 32];
+    err_o    = '0;
+
+    unique case (state_q)
+      IDLE: begin
+        if (req_i && we_i) begin
+          axi_req_o.aw_valid = !aw_done_q;
+          axi_req_o.w_valid  = !w_done_q;
+
+          if ((aw_done_q || axi_rsp_i.aw_ready) && (w_done_q || axi_rsp_i.w_ready)) begin
+            gnt_o     = '1;
+            aw_done_d = '0;
+            w_done_d  = '0;
+            state_d   = WRITE_RESPONSE;
+          end else begin
+            aw_done_d = aw_done_q || axi_rsp_i.aw_ready;
+            w_done_d  = w_done_q || axi_rsp_i.w_ready;
+          end
+        end else if (req_i) begin
+          axi_req_o.ar_valid = '1;
+          if (axi_rsp_i.ar_ready) begin
+            gnt_o   = '1;
+            state_d = READ_RESPONSE;
+          end
+        end
+      end
+      READ_RESPONSE: begin
+        axi_req_o.r_ready = '1;
+        if (axi_rsp_i.r_valid) begin
+          rvalid_o = '1;
+          err_o    = axi_rsp_i.r.resp[1];
+          state_d  = IDLE;
+        end
+      end
+      WRITE_RESPONSE: begin
+        axi_req_o.b_ready = '1;
+        if (axi_rsp_i.b_valid) begin
+          rvalid_o = '1;
+          err_o    = axi_rsp_i.b.resp[1];
+          state_d  = IDLE;
+        end
+      end
+      default: state_d = IDLE;
+    endcase
+  end
+
+endmodule
@@ -15,4 +15,13 @@ package sdhci_pkg;
 
   typedef logic [5:0]  cmd_t;
   typedef logic [31:0] cmd_arg_t;
+
+  // CMD19 tuning block of a 4-bit bus, as the data buffer words it would land in
+  localparam int unsigned TuningBlockWords = 16;
+  localparam logic [TuningBlockWords-1:0][31:0] TuningBlock4Bit = {
+    32'hde7b7ff7, 32'hfff7ffbb, 32'hffbfffdf, 32'hfdfffdff,
+    32'heeffefff, 32'hcfcc33cc, 32'h3cccfc0f, 32'hf0fff0ff,
+    32'hefbdf777, 32'hff7fffbf, 32'hfbfffbff, 32'hddffdfff,
+    32'heffefffe, 32'hffcc3cc3, 32'hccc3ccff, 32'h00ff0fff
+  };
 endpackage
@@ -8,16 +8,20 @@
 // - Axel Vanoni <axvanoni@student.ethz.ch>
 
 `include "common_cells/registers.svh"
+`include "register_interface/typedef.svh"
 `include "defines.svh"
 
 module sdhci_top #(
   parameter int unsigned AddrWidth = 32'd32,
+  // register bus width, 32 or 64. The registers stay 32 bit wide, the buffer data window
+  // at 0x200 - 0x3ff moves a whole bus word per access.
+  parameter int unsigned DataWidth = 32'd32,
   parameter type               reg_req_t   = logic,
   parameter type               reg_rsp_t   = logic,
 
   //sw handles clock division. However, largest base freq. accepted is 63MHz!
   //-> internal clock predivider to get below 63MHz
-  //only power of 2 dividers allowed :(
+  //only power of 2 predividers allowed, the sd clock divider after it takes any even divisor
   //input log2 of divider i.e div by 4 ->  ClkPreDivLog = 2
   parameter int unsigned       ClkPreDivLog   = 1,
   //also change base_clock_frequency_for_sd_clock resval in reg/sdhci_regs.hjson and regenerate registers
@@ -26,7 +30,20 @@ module sdhci_top #(
                                     // see dat_timeout for details
 
   // clock runs at 50MHz, so 1ms is 50_000 cycles
-  parameter int unsigned       NumDebounceCycles = 500_000 // 10ms
+  parameter int unsigned       NumDebounceCycles = 500_000, // 10ms
+
+  parameter int unsigned       CmdQueueDepth = 4, // driver commands that can be queued back to back
+
+  // 512 byte blocks the data buffer holds, power of two. 2 double buffers,
+  // more lets the card keep streaming while the host or dma lags behind.
+  parameter int unsigned       NumBufferBlocks = 2,
+
+  // dual port buffer SRAM, the sd side and the host side no longer wait for each other
+  // when they access the buffer in the same cycle, e.g. at div_1 or with dma.
+  parameter bit                DualPortBuffer = 1'b0,
+
+  // sampling points the tuning engine tries, one clk_i cycle apart, see sdhci_tuning
+  parameter int unsigned       NumTuningTaps = 8
 ) (
   input  logic clk_i,
   input  logic rst_ni,
@@ -40,10 +57,24 @@ module sdhci_top #(
   output logic       sd_cmd_o,
   input  logic       sd_cmd_i,
 
-  input  logic [3:0] sd_dat_i,
-  output logic [3:0] sd_dat_o,
+  input  logic [7:0] sd_dat_i,
+  output logic [7:0] sd_dat_o,
   output logic       sd_dat_en_o,
 
+  // switches the card io supply to 1.8V for UHS-I
+  output logic       sd_1v8_en_o,
+
+  // SDMA manager port, gnt/rvalid handshake
+  output logic        dma_req_o,
+  input  logic        dma_gnt_i,
+  output logic [31:0] dma_addr_o,
+  output logic        dma_we_o,
+  output logic [3:0]  dma_be_o,
+  output logic [31:0] dma_wdata_o,
+  input  logic        dma_rvalid_i,
+  input  logic [31:0] dma_rdata_i,
+  input  logic        dma_err_i,
+
   output logic interrupt_o
 
 );
@@ -73,22 +104,67 @@ module sdhci_top #(
   assign hw2reg.software_reset.software_reset_for_dat_line.de = software_reset_dat_q;
   assign hw2reg.software_reset.software_reset_for_cmd_line.de = software_reset_cmd_q;
 
+  // Buffer Data Window ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Every address in 0x200 - 0x3ff is an alias of the buffer data port. A whole 512 byte block maps
+  // linearly onto it, so memcpy, vector loads and bursts or write combining in the interconnect
+  // work. Every access pops / pushes a whole bus word, only whole bus words can be written there.
+  // Accesses below 0x200 go to the 32 bit registers, on a wider bus the address selects the lane.
+  localparam int unsigned NumLanes  = DataWidth / 32;
+  localparam int unsigned LaneWidth = cf_math_pkg::idx_width(NumLanes);
+
+  `REG_BUS_TYPEDEF_ALL(sdhci_regs, logic [AddrWidth-1:0], logic [31:0], logic [3:0])
+  sdhci_regs_req_t regs_req;
+  sdhci_regs_rsp_t regs_rsp;
+
+  logic                 window_sel, window_pop, window_push;
+  logic [DataWidth-1:0] window_pop_data;
+  logic [LaneWidth-1:0] lane;
+
+  assign window_sel = reg_req_i.addr[9];
+  assign lane       = LaneWidth'((reg_req_i.addr >> 2) % NumLanes);
+
+  always_comb begin : reg_demux
+    regs_req       = '0;
+    regs_req.addr  = reg_req_i.addr;
+    regs_req.write = reg_req_i.write;
+    regs_req.wdata = reg_req_i.wdata[lane*32 +: 32];
+    regs_req.wstrb = reg_req_i.wstrb[lane*4 +: 4];
+    regs_req.valid = reg_req_i.valid && !window_sel;
+
+    window_pop  = reg_req_i.valid && window_sel && !reg_req_i.write;
+    window_push = reg_req_i.valid && window_sel && reg_req_i.write && &reg_req_i.wstrb;
+
+    reg_rsp_o = '0;
+    if (window_sel) begin
+      reg_rsp_o.rdata = window_pop_data;
+      reg_rsp_o.error = reg_req_i.write && !(&reg_req_i.wstrb);
+      reg_rsp_o.ready = 1'b1;
+    end else begin
+      reg_rsp_o.rdata = {NumLanes{regs_rsp.rdata}};
+      reg_rsp_o.error = regs_rsp.error;
+      reg_rsp_o.ready = regs_rsp.ready;
+    end
+  end
+
+  assign hw2reg.buffer_data_window.d = 8'(DataWidth / 8);
+
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
   sdhci_reg_top #(
     .AW        (AddrWidth),
-    .reg_req_t (reg_req_t),
-    .reg_rsp_t (reg_rsp_t)
+    .reg_req_t (sdhci_regs_req_t),
+    .reg_rsp_t (sdhci_regs_rsp_t)
   ) i_regs (
     .clk_i,
     .rst_ni    (sd_rst_n),
-    .reg_req_i,
-    .reg_rsp_o,
+    .reg_req_i (regs_req),
+    .reg_rsp_o (regs_rsp),
     .reg2hw    (reg2hw_orig),
     .hw2reg,
     .devmode_i (1'b1)
   );
 
   logic  sd_cmd_dat_busy;
+  logic  tuning_block_done, tuning_block_ok;
 
   `writable_reg_t([15:0]) block_count_hw;
 
@@ -103,7 +179,8 @@ module sdhci_top #(
     .hw2reg_i          (hw2reg),
     .reg2hw_modified_o (reg2hw),
 
-    .sd_cmd_dat_busy_i (sd_cmd_dat_busy),
+    .sd_cmd_dat_busy_i   (sd_cmd_dat_busy),
+    .tuning_block_done_i (tuning_block_done),
 
     .error_interrupt_o  (hw2reg.normal_interrupt_status.error_interrupt),
     .auto_cmd12_error_o (hw2reg.error_interrupt_status.auto_cmd12_error),
@@ -161,7 +238,7 @@ module sdhci_top #(
     .data_o   (sd_card_detected_debounced)
   );
 
-  assign hw2reg.present_state.dat_line_signal_level = '{ de: '1, d: sd_dat_i };
+  assign hw2reg.present_state.dat_line_signal_level = '{ de: '1, d: sd_dat_i[3:0] };
   assign hw2reg.present_state.cmd_line_signal_level = '{ de: '1, d: sd_cmd_i };
 
   assign hw2reg.present_state.write_protect_switch_pin_level = '{ de: '1, d: '1 };
@@ -170,17 +247,46 @@ module sdhci_top #(
   assign hw2reg.present_state.card_detect_pin_level          = '{ de: '1, d: sd_card_detected };
 
 
+  assign sd_1v8_en_o = reg2hw.host_control_2.signaling_1_8v_enable.q;
+
+  logic       sd_cmd_sampled;
+  logic [7:0] sd_dat_sampled;
+
+  sdhci_tuning #(
+    .NumTaps (NumTuningTaps)
+  ) i_tuning (
+    .clk_i,
+    .rst_ni (sd_rst_n),
+
+    .sd_cmd_i (sd_cmd_i),
+    .sd_dat_i (sd_dat_i),
+    .sd_cmd_o (sd_cmd_sampled),
+    .sd_dat_o (sd_dat_sampled),
+
+    .execute_tuning_i        (reg2hw.host_control_2.execute_tuning.q),
+    .sampling_clock_select_i (reg2hw.host_control_2.sampling_clock_select.q),
+
+    .block_done_i (tuning_block_done),
+    .block_ok_i   (tuning_block_ok),
+
+    .execute_tuning_o        (hw2reg.host_control_2.execute_tuning),
+    .sampling_clock_select_o (hw2reg.host_control_2.sampling_clock_select)
+  );
+
+
   logic sd_cmd_done, sd_rsp_done, request_cmd12;
 
-  logic cmd_started, cmd_needs_busy, cmd_data_present, cmd_transfer_direction;
+  logic cmd_started, cmd_needs_busy, cmd_data_present, cmd_transfer_direction, cmd_suspend;
 
-  autocmd_wrap  i_autocmd_wrap (
+  autocmd_wrap #(
+    .CmdQueueDepth(CmdQueueDepth)
+  ) i_autocmd_wrap (
     .clk_i           (clk_i),
     .rst_ni          (sd_rst_cmd_n),
     .clk_en_p_i      (sd_clk_en_p),
     .clk_en_n_i      (sd_clk_en_n),
     .div_1_i         (div_1),
-    .sd_bus_cmd_i    (sd_cmd_i),
+    .sd_bus_cmd_i    (sd_cmd_sampled),
     .sd_bus_cmd_o    (sd_cmd_o),
     .sd_bus_cmd_en_o (sd_cmd_en_o),
     .reg2hw          (reg2hw),
@@ -194,6 +300,7 @@ module sdhci_top #(
     .cmd_needs_busy_o         (cmd_needs_busy),
     .cmd_data_present_o       (cmd_data_present),
     .cmd_transfer_direction_o (cmd_transfer_direction),
+    .cmd_suspend_o            (cmd_suspend),
 
     .response0_d_o  (hw2reg.response0.d),
     .response1_d_o  (hw2reg.response1.d),
@@ -204,6 +311,7 @@ module sdhci_top #(
     .response2_de_o (hw2reg.response2.de),
     .response3_de_o (hw2reg.response3.de),
     .command_inhibit_cmd_o    (hw2reg.present_state.command_inhibit_cmd),
+    .cmd_queue_free_entries_o (hw2reg.command_queue_status.d),
     .command_end_bit_error_o  (hw2reg.error_interrupt_status.command_end_bit_error),
     .command_crc_error_o      (hw2reg.error_interrupt_status.command_crc_error),
     .command_index_error_o    (hw2reg.error_interrupt_status.command_index_error),
@@ -213,7 +321,10 @@ module sdhci_top #(
 
 
   dat_wrap #(
-    .TimeoutDivider(TimeoutDivider)
+    .TimeoutDivider (TimeoutDivider),
+    .NumBufferBlocks(NumBufferBlocks),
+    .DataWidth      (DataWidth),
+    .DualPortBuffer (DualPortBuffer)
   ) i_dat_wrap (
     .clk_i,
     .sd_clk_en_p_i  (sd_clk_en_p),
@@ -221,7 +332,7 @@ module sdhci_top #(
     .div_1_i        (div_1),
     .rst_ni      (sd_rst_dat_n),
 
-    .dat_i    (sd_dat_i),
+    .dat_i    (sd_dat_sampled),
     .dat_en_o (sd_dat_en_o),
     .dat_o    (sd_dat_o),
 
@@ -229,6 +340,7 @@ module sdhci_top #(
     .cmd_needs_busy_i         (cmd_needs_busy),
     .cmd_data_present_i       (cmd_data_present),
     .cmd_transfer_direction_i (cmd_transfer_direction),
+    .cmd_suspend_i            (cmd_suspend),
 
     .sd_cmd_done_i   (sd_cmd_done),
     .sd_rsp_done_i   (sd_rsp_done),
@@ -237,6 +349,12 @@ module sdhci_top #(
     .request_cmd12_o (request_cmd12),
     .pause_sd_clk_o  (pause_sd_clk),
 
+    .block_gap_event_o  (hw2reg.normal_interrupt_status.block_gap_event),
+    .continue_request_o (hw2reg.block_gap_control.continue_request),
+
+    .tuning_block_done_o (tuning_block_done),
+    .tuning_block_ok_o   (tuning_block_ok),
+
     .reg2hw_i (reg2hw),
 
     .data_crc_error_o        (hw2reg.error_interrupt_status.data_crc_error),
@@ -244,13 +362,35 @@ module sdhci_top #(
     .data_timeout_error_o    (hw2reg.error_interrupt_status.data_timeout_error),
 
     .buffer_data_port_d_o    (hw2reg.buffer_data_port.d),
+    .window_pop_i            (window_pop),
+    .window_push_i           (window_push),
+    .window_push_data_i      (reg_req_i.wdata),
+    .window_pop_data_o       (window_pop_data),
     .buffer_read_enable_o    (hw2reg.present_state.buffer_read_enable),
     .buffer_write_enable_o   (hw2reg.present_state.buffer_write_enable),
 
     .read_transfer_active_o  (hw2reg.present_state.read_transfer_active),
     .write_transfer_active_o (hw2reg.present_state.write_transfer_active),
 
-    .block_count_o           (block_count_hw)
+    .block_count_o           (block_count_hw),
+
+    .dma_req_o,
+    .dma_gnt_i,
+    .dma_addr_o,
+    .dma_we_o,
+    .dma_be_o,
+    .dma_wdata_o,
+    .dma_rvalid_i,
+    .dma_rdata_i,
+    .dma_err_i,
+
+    .system_address_o (hw2reg.system_address),
+    .dma_interrupt_o  (hw2reg.normal_interrupt_status.dma_interrupt),
+    .dma_error_o      (hw2reg.error_interrupt_status.vendor_specific_error),
+
+    .adma_system_address_o (hw2reg.adma_system_address),
+    .adma_error_o          (hw2reg.error_interrupt_status.adma_error),
+    .adma_error_status_o   (hw2reg.adma_error_status)
   );
 
 endmodule
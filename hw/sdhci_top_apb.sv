@@ -0,0 +1,205 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+`include "register_interface/typedef.svh"
+
+module sdhci_top_apb #(
+  parameter int unsigned ApbAddrWidth      = 32,
+  // 32 or 64, see the buffer data window in sdhci_top
+  parameter int unsigned ApbDataWidth      = 32,
+  // SDMA manager port, single beat AXI4 transactions, 32 or 64 bit data
+  parameter int unsigned AxiMgrDataWidth   = 32,
+  parameter type         axi_mgr_req_t     = logic,
+  parameter type         axi_mgr_rsp_t     = logic,
+  parameter int unsigned ClkPreDivLog      = 1,
+  parameter int unsigned NumDebounceCycles = 500_000,
+  parameter int          TimeoutDivider    = 1,
+  parameter int unsigned CmdQueueDepth     = 4,
+  parameter int unsigned NumBufferBlocks   = 2,
+  parameter bit          DualPortBuffer    = 1'b0,
+  parameter int unsigned NumTuningTaps     = 8,
+  // Run the controller on sd_base_clk_i instead of clk_i, see sdhci_cdc
+  parameter bit          SdBaseClk         = 1'b0
+) (
+  input  logic clk_i,
+  input  logic rst_ni,
+  input  logic sd_base_clk_i, // only used with SdBaseClk
+
+  // APB4 subordinate
+  input  logic                      psel_i,
+  input  logic                      penable_i,
+  input  logic                      pwrite_i,
+  input  logic [ApbAddrWidth-1:0]   paddr_i,
+  input  logic [ApbDataWidth-1:0]   pwdata_i,
+  input  logic [ApbDataWidth/8-1:0] pstrb_i,
+  output logic                      pready_o,
+  output logic [ApbDataWidth-1:0]   prdata_o,
+  output logic                      pslverr_o,
+
+  output axi_mgr_req_t axi_mgr_req_o,
+  input  axi_mgr_rsp_t axi_mgr_rsp_i,
+
+  output logic       sd_clk_o,
+  input  logic       sd_cd_ni,
+  output logic       sd_cmd_en_o,
+  output logic       sd_cmd_o,
+  input  logic       sd_cmd_i,
+
+  input  logic [7:0] sd_dat_i,
+  output logic [7:0] sd_dat_o,
+  output logic       sd_dat_en_o,
+
+  output logic       sd_1v8_en_o,
+
+  output logic interrupt_o
+);
+  `REG_BUS_TYPEDEF_ALL(
+    reg,
+    logic [ApbAddrWidth-1:0],
+    logic [ApbDataWidth-1:0],
+    logic [ApbDataWidth/8-1:0]
+  )
+  reg_req_t reg_req;
+  reg_rsp_t reg_rsp;
+
+  // The access phase maps directly onto a register bus request, the registers answer in the same
+  // cycle so every access takes the minimum of two APB cycles. With SdBaseClk pready_o waits for
+  // the register cdc.
+  always_comb begin : apb_to_reg
+    reg_req       = '0;
+    reg_req.addr  = paddr_i;
+    reg_req.write = pwrite_i;
+    reg_req.wdata = pwdata_i;
+    reg_req.wstrb = pwrite_i ? pstrb_i : '1;
+    reg_req.valid = psel_i && penable_i;
+  end
+
+  assign pready_o  = reg_rsp.ready;
+  assign prdata_o  = reg_rsp.rdata;
+  assign pslverr_o = reg_rsp.error;
+
+  logic        dma_req, dma_gnt, dma_we, dma_rvalid, dma_err;
+  logic [31:0] dma_addr, dma_wdata, dma_rdata;
+  logic [3:0]  dma_be;
+
+  sdhci_dma_to_axi #(
+    .AxiDataWidth (AxiMgrDataWidth),
+    .axi_req_t    (axi_mgr_req_t),
+    .axi_rsp_t    (axi_mgr_rsp_t)
+  ) i_dma_to_axi (
+    .clk_i,
+    .rst_ni,
+
+    .req_i    (dma_req),
+    .gnt_o    (dma_gnt),
+    .addr_i   (dma_addr),
+    .we_i     (dma_we),
+    .be_i     (dma_be),
+    .wdata_i  (dma_wdata),
+    .rvalid_o (dma_rvalid),
+    .rdata_o  (dma_rdata),
+    .err_o    (dma_err),
+
+    .axi_req_o (axi_mgr_req_o),
+    .axi_rsp_i (axi_mgr_rsp_i)
+  );
+
+  reg_req_t    core_reg_req;
+  reg_rsp_t    core_reg_rsp;
+  logic        core_clk, core_rst_n, core_interrupt;
+  logic        core_dma_req, core_dma_gnt, core_dma_we, core_dma_rvalid, core_dma_err;
+  logic [31:0] core_dma_addr, core_dma_wdata, core_dma_rdata;
+  logic [3:0]  core_dma_be;
+
+  sdhci_cdc #(
+    .Bypass    (!SdBaseClk),
+    .reg_req_t (reg_req_t),
+    .reg_rsp_t (reg_rsp_t)
+  ) i_cdc (
+    .clk_i,
+    .rst_ni,
+
+    .reg_req_i (reg_req),
+    .reg_rsp_o (reg_rsp),
+
+    .dma_req_o    (dma_req),
+    .dma_gnt_i    (dma_gnt),
+    .dma_addr_o   (dma_addr),
+    .dma_we_o     (dma_we),
+    .dma_be_o     (dma_be),
+    .dma_wdata_o  (dma_wdata),
+    .dma_rvalid_i (dma_rvalid),
+    .dma_rdata_i  (dma_rdata),
+    .dma_err_i    (dma_err),
+
+    .interrupt_o,
+
+    .sd_base_clk_i,
+    .core_clk_o  (core_clk),
+    .core_rst_no (core_rst_n),
+
+    .core_reg_req_o (core_reg_req),
+    .core_reg_rsp_i (core_reg_rsp),
+
+    .core_dma_req_i    (core_dma_req),
+    .core_dma_gnt_o    (core_dma_gnt),
+    .core_dma_addr_i   (core_dma_addr),
+    .core_dma_we_i     (core_dma_we),
+    .core_dma_be_i     (core_dma_be),
+    .core_dma_wdata_i  (core_dma_wdata),
+    .core_dma_rvalid_o (core_dma_rvalid),
+    .core_dma_rdata_o  (core_dma_rdata),
+    .core_dma_err_o    (core_dma_err),
+
+    .core_interrupt_i (core_interrupt)
+  );
+
+  sdhci_top #(
+    .AddrWidth        (ApbAddrWidth),
+    .DataWidth        (ApbDataWidth),
+    .reg_req_t        (reg_req_t),
+    .reg_rsp_t        (reg_rsp_t),
+    .ClkPreDivLog     (ClkPreDivLog),
+    .NumDebounceCycles(NumDebounceCycles),
+    .TimeoutDivider   (TimeoutDivider),
+    .CmdQueueDepth    (CmdQueueDepth),
+    .NumBufferBlocks  (NumBufferBlocks),
+    .DualPortBuffer   (DualPortBuffer),
+    .NumTuningTaps    (NumTuningTaps)
+  ) i_sdhci_impl (
+    .clk_i  (core_clk),
+    .rst_ni (core_rst_n),
+
+    .reg_req_i(core_reg_req),
+    .reg_rsp_o(core_reg_rsp),
+
+    .sd_clk_o,
+    .sd_cd_ni,
+
+    .sd_cmd_en_o,
+    .sd_cmd_o,
+    .sd_cmd_i,
+
+    .sd_dat_i,
+    .sd_dat_o,
+    .sd_dat_en_o,
+
+    .sd_1v8_en_o,
+
+    .dma_req_o    (core_dma_req),
+    .dma_gnt_i    (core_dma_gnt),
+    .dma_addr_o   (core_dma_addr),
+    .dma_we_o     (core_dma_we),
+    .dma_be_o     (core_dma_be),
+    .dma_wdata_o  (core_dma_wdata),
+    .dma_rvalid_i (core_dma_rvalid),
+    .dma_rdata_i  (core_dma_rdata),
+    .dma_err_i    (core_dma_err),
+
+    .interrupt_o  (core_interrupt)
+  );
+endmodule
@@ -0,0 +1,202 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+`include "register_interface/typedef.svh"
+
+module sdhci_top_axi #(
+  parameter int unsigned AxiAddrWidth      = 32,
+  // 32 or 64, see the buffer data window in sdhci_top
+  parameter int unsigned AxiDataWidth      = 32,
+  parameter type         axi_lite_req_t    = logic,
+  parameter type         axi_lite_rsp_t    = logic,
+  // SDMA manager port, single beat AXI4 transactions, 32 or 64 bit data
+  parameter int unsigned AxiMgrDataWidth   = 32,
+  parameter type         axi_mgr_req_t     = logic,
+  parameter type         axi_mgr_rsp_t     = logic,
+  parameter int unsigned ClkPreDivLog      = 1,
+  parameter int unsigned NumDebounceCycles = 500_000,
+  parameter int          TimeoutDivider    = 1,
+  parameter int unsigned CmdQueueDepth     = 4,
+  parameter int unsigned NumBufferBlocks   = 2,
+  parameter bit          DualPortBuffer    = 1'b0,
+  parameter int unsigned NumTuningTaps     = 8,
+  // Run the controller on sd_base_clk_i instead of clk_i, see sdhci_cdc
+  parameter bit          SdBaseClk         = 1'b0
+) (
+  input  logic clk_i,
+  input  logic rst_ni,
+  input  logic sd_base_clk_i, // only used with SdBaseClk
+
+  input  axi_lite_req_t axi_lite_req_i,
+  output axi_lite_rsp_t axi_lite_rsp_o,
+
+  output axi_mgr_req_t axi_mgr_req_o,
+  input  axi_mgr_rsp_t axi_mgr_rsp_i,
+
+  output logic       sd_clk_o,
+  input  logic       sd_cd_ni,
+  output logic       sd_cmd_en_o,
+  output logic       sd_cmd_o,
+  input  logic       sd_cmd_i,
+
+  input  logic [7:0] sd_dat_i,
+  output logic [7:0] sd_dat_o,
+  output logic       sd_dat_en_o,
+
+  output logic       sd_1v8_en_o,
+
+  output logic interrupt_o
+);
+  `REG_BUS_TYPEDEF_ALL(
+    reg,
+    logic [AxiAddrWidth-1:0],
+    logic [AxiDataWidth-1:0],
+    logic [AxiDataWidth/8-1:0]
+  )
+  reg_req_t reg_req;
+  reg_rsp_t reg_rsp;
+
+  axi_lite_to_reg #(
+    .ADDR_WIDTH     (AxiAddrWidth),
+    .DATA_WIDTH     (AxiDataWidth),
+    .BUFFER_DEPTH   (2),
+    .DECOUPLE_W     (1'b0),
+    .axi_lite_req_t (axi_lite_req_t),
+    .axi_lite_rsp_t (axi_lite_rsp_t),
+    .reg_req_t      (reg_req_t),
+    .reg_rsp_t      (reg_rsp_t)
+  ) i_axi_lite_to_reg (
+    .clk_i,
+    .rst_ni,
+
+    .axi_lite_req_i (axi_lite_req_i),
+    .axi_lite_rsp_o (axi_lite_rsp_o),
+    .reg_req_o      (reg_req),
+    .reg_rsp_i      (reg_rsp)
+  );
+
+  logic        dma_req, dma_gnt, dma_we, dma_rvalid, dma_err;
+  logic [31:0] dma_addr, dma_wdata, dma_rdata;
+  logic [3:0]  dma_be;
+
+  sdhci_dma_to_axi #(
+    .AxiDataWidth (AxiMgrDataWidth),
+    .axi_req_t    (axi_mgr_req_t),
+    .axi_rsp_t    (axi_mgr_rsp_t)
+  ) i_dma_to_axi (
+    .clk_i,
+    .rst_ni,
+
+    .req_i    (dma_req),
+    .gnt_o    (dma_gnt),
+    .addr_i   (dma_addr),
+    .we_i     (dma_we),
+    .be_i     (dma_be),
+    .wdata_i  (dma_wdata),
+    .rvalid_o (dma_rvalid),
+    .rdata_o  (dma_rdata),
+    .err_o    (dma_err),
+
+    .axi_req_o (axi_mgr_req_o),
+    .axi_rsp_i (axi_mgr_rsp_i)
+  );
+
+  reg_req_t    core_reg_req;
+  reg_rsp_t    core_reg_rsp;
+  logic        core_clk, core_rst_n, core_interrupt;
+  logic        core_dma_req, core_dma_gnt, core_dma_we, core_dma_rvalid, core_dma_err;
+  logic [31:0] core_dma_addr, core_dma_wdata, core_dma_rdata;
+  logic [3:0]  core_dma_be;
+
+  sdhci_cdc #(
+    .Bypass    (!SdBaseClk),
+    .reg_req_t (reg_req_t),
+    .reg_rsp_t (reg_rsp_t)
+  ) i_cdc (
+    .clk_i,
+    .rst_ni,
+
+    .reg_req_i (reg_req),
+    .reg_rsp_o (reg_rsp),
+
+    .dma_req_o    (dma_req),
+    .dma_gnt_i    (dma_gnt),
+    .dma_addr_o   (dma_addr),
+    .dma_we_o     (dma_we),
+    .dma_be_o     (dma_be),
+    .dma_wdata_o  (dma_wdata),
+    .dma_rvalid_i (dma_rvalid),
+    .dma_rdata_i  (dma_rdata),
+    .dma_err_i    (dma_err),
+
+    .interrupt_o,
+
+    .sd_base_clk_i,
+    .core_clk_o  (core_clk),
+    .core_rst_no (core_rst_n),
+
+    .core_reg_req_o (core_reg_req),
+    .core_reg_rsp_i (core_reg_rsp),
+
+    .core_dma_req_i    (core_dma_req),
+    .core_dma_gnt_o    (core_dma_gnt),
+    .core_dma_addr_i   (core_dma_addr),
+    .core_dma_we_i     (core_dma_we),
+    .core_dma_be_i     (core_dma_be),
+    .core_dma_wdata_i  (core_dma_wdata),
+    .core_dma_rvalid_o (core_dma_rvalid),
+    .core_dma_rdata_o  (core_dma_rdata),
+    .core_dma_err_o    (core_dma_err),
+
+    .core_interrupt_i (core_interrupt)
+  );
+
+  sdhci_top #(
+    .AddrWidth        (AxiAddrWidth),
+    .DataWidth        (AxiDataWidth),
+    .reg_req_t        (reg_req_t),
+    .reg_rsp_t        (reg_rsp_t),
+    .ClkPreDivLog     (ClkPreDivLog),
+    .NumDebounceCycles(NumDebounceCycles),
+    .TimeoutDivider   (TimeoutDivider),
+    .CmdQueueDepth    (CmdQueueDepth),
+    .NumBufferBlocks  (NumBufferBlocks),
+    .DualPortBuffer   (DualPortBuffer),
+    .NumTuningTaps    (NumTuningTaps)
+  ) i_sdhci_impl (
+    .clk_i  (core_clk),
+    .rst_ni (core_rst_n),
+
+    .reg_req_i(core_reg_req),
+    .reg_rsp_o(core_reg_rsp),
+
+    .sd_clk_o,
+    .sd_cd_ni,
+
+    .sd_cmd_en_o,
+    .sd_cmd_o,
+    .sd_cmd_i,
+
+    .sd_dat_i,
+    .sd_dat_o,
+    .sd_dat_en_o,
+
+    .sd_1v8_en_o,
+
+    .dma_req_o    (core_dma_req),
+    .dma_gnt_i    (core_dma_gnt),
+    .dma_addr_o   (core_dma_addr),
+    .dma_we_o     (core_dma_we),
+    .dma_be_o     (core_dma_be),
+    .dma_wdata_o  (core_dma_wdata),
+    .dma_rvalid_i (core_dma_rvalid),
+    .dma_rdata_i  (core_dma_rdata),
+    .dma_err_i    (core_dma_err),
+
+    .interrupt_o  (core_interrupt)
+  );
+endmodule
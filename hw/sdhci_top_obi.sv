@@ -9,36 +9,52 @@
 `include "register_interface/typedef.svh"
 
 module sdhci_top_obi #(
+  // 32 or 64 bit data, see the buffer data window in sdhci_top
   parameter obi_pkg::obi_cfg_t ObiCfg            = obi_pkg::ObiDefaultConfig,
   parameter type               obi_req_t         = logic,
   parameter type               obi_rsp_t         = logic,
+  // SDMA manager port, 32 bit data
+  parameter type               obi_mgr_req_t     = logic,
+  parameter type               obi_mgr_rsp_t     = logic,
   parameter int unsigned       ClkPreDivLog      = 1,
   parameter int unsigned       NumDebounceCycles = 500_000,
-  parameter int                TimeoutDivider    = 1
+  parameter int                TimeoutDivider    = 1,
+  parameter int unsigned       CmdQueueDepth     = 4,
+  parameter int unsigned       NumBufferBlocks   = 2,
+  parameter bit                DualPortBuffer    = 1'b0,
+  parameter int unsigned       NumTuningTaps     = 8,
+  // Run the controller on sd_base_clk_i instead of clk_i, see sdhci_cdc
+  parameter bit                SdBaseClk         = 1'b0
 ) (
   input  logic clk_i,
   input  logic rst_ni,
+  input  logic sd_base_clk_i, // only used with SdBaseClk
 
   input  obi_req_t obi_req_i,
   output obi_rsp_t obi_rsp_o,
 
+  output obi_mgr_req_t obi_mgr_req_o,
+  input  obi_mgr_rsp_t obi_mgr_rsp_i,
+
   output logic       sd_clk_o,
   input  logic       sd_cd_ni,
   output logic       sd_cmd_en_o,
   output logic       sd_cmd_o,
   input  logic       sd_cmd_i,
 
-  input  logic [3:0] sd_dat_i,
-  output logic [3:0] sd_dat_o,
+  input  logic [7:0] sd_dat_i,
+  output logic [7:0] sd_dat_o,
   output logic       sd_dat_en_o,
 
+  output logic       sd_1v8_en_o,
+
   output logic interrupt_o
 );
   `REG_BUS_TYPEDEF_ALL(
     reg,
     logic [ObiCfg.AddrWidth-1:0],
     logic [ObiCfg.DataWidth-1:0],
-    logic [ObiCfg.AddrWidth/8-1:0]
+    logic [ObiCfg.DataWidth/8-1:0]
   )
   reg_req_t reg_req;
   reg_rsp_t reg_rsp;
@@ -61,19 +77,87 @@ module sdhci_top_obi #(
     .reg_rsp_i (reg_rsp)
   );
 
+  logic        dma_req, dma_we;
+  logic [31:0] dma_addr, dma_wdata;
+  logic [3:0]  dma_be;
+
+  reg_req_t    core_reg_req;
+  reg_rsp_t    core_reg_rsp;
+  logic        core_clk, core_rst_n, core_interrupt;
+  logic        core_dma_req, core_dma_gnt, core_dma_we, core_dma_rvalid, core_dma_err;
+  logic [31:0] core_dma_addr, core_dma_wdata, core_dma_rdata;
+  logic [3:0]  core_dma_be;
+
+  sdhci_cdc #(
+    .Bypass    (!SdBaseClk),
+    .reg_req_t (reg_req_t),
+    .reg_rsp_t (reg_rsp_t)
+  ) i_cdc (
+    .clk_i,
+    .rst_ni,
+
+    .reg_req_i (reg_req),
+    .reg_rsp_o (reg_rsp),
+
+    .dma_req_o    (dma_req),
+    .dma_gnt_i    (obi_mgr_rsp_i.gnt),
+    .dma_addr_o   (dma_addr),
+    .dma_we_o     (dma_we),
+    .dma_be_o     (dma_be),
+    .dma_wdata_o  (dma_wdata),
+    .dma_rvalid_i (obi_mgr_rsp_i.rvalid),
+    .dma_rdata_i  (obi_mgr_rsp_i.r.rdata),
+    .dma_err_i    (obi_mgr_rsp_i.r.err),
+
+    .interrupt_o,
+
+    .sd_base_clk_i,
+    .core_clk_o  (core_clk),
+    .core_rst_no (core_rst_n),
+
+    .core_reg_req_o (core_reg_req),
+    .core_reg_rsp_i (core_reg_rsp),
+
+    .core_dma_req_i    (core_dma_req),
+    .core_dma_gnt_o    (core_dma_gnt),
+    .core_dma_addr_i   (core_dma_addr),
+    .core_dma_we_i     (core_dma_we),
+    .core_dma_be_i     (core_dma_be),
+    .core_dma_wdata_i  (core_dma_wdata),
+    .core_dma_rvalid_o (core_dma_rvalid),
+    .core_dma_rdata_o  (core_dma_rdata),
+    .core_dma_err_o    (core_dma_err),
+
+    .core_interrupt_i (core_interrupt)
+  );
+
+  always_comb begin : obi_mgr
+    obi_mgr_req_o         = '0;
+    obi_mgr_req_o.req     = dma_req;
+    obi_mgr_req_o.a.addr  = dma_addr;
+    obi_mgr_req_o.a.we    = dma_we;
+    obi_mgr_req_o.a.be    = dma_be;
+    obi_mgr_req_o.a.wdata = dma_wdata;
+  end
+
   sdhci_top #(
     .AddrWidth        (ObiCfg.AddrWidth),
+    .DataWidth        (ObiCfg.DataWidth),
     .reg_req_t        (reg_req_t),
     .reg_rsp_t        (reg_rsp_t),
     .ClkPreDivLog     (ClkPreDivLog),
     .NumDebounceCycles(NumDebounceCycles),
-    .TimeoutDivider   (TimeoutDivider)
+    .TimeoutDivider   (TimeoutDivider),
+    .CmdQueueDepth    (CmdQueueDepth),
+    .NumBufferBlocks  (NumBufferBlocks),
+    .DualPortBuffer   (DualPortBuffer),
+    .NumTuningTaps    (NumTuningTaps)
   ) i_sdhci_impl (
-    .clk_i,
-    .rst_ni,
+    .clk_i  (core_clk),
+    .rst_ni (core_rst_n),
 
-    .reg_req_i(reg_req),
-    .reg_rsp_o(reg_rsp),
+    .reg_req_i(core_reg_req),
+    .reg_rsp_o(core_reg_rsp),
 
     .sd_clk_o,
     .sd_cd_ni,
@@ -86,6 +170,18 @@ module sdhci_top_obi #(
     .sd_dat_o,
     .sd_dat_en_o,
 
-    .interrupt_o
+    .sd_1v8_en_o,
+
+    .dma_req_o    (core_dma_req),
+    .dma_gnt_i    (core_dma_gnt),
+    .dma_addr_o   (core_dma_addr),
+    .dma_we_o     (core_dma_we),
+    .dma_be_o     (core_dma_be),
+    .dma_wdata_o  (core_dma_wdata),
+    .dma_rvalid_i (core_dma_rvalid),
+    .dma_rdata_i  (core_dma_rdata),
+    .dma_err_i    (core_dma_err),
+
+    .interrupt_o  (core_interrupt)
   );
 endmodule
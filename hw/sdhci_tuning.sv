@@ -0,0 +1,134 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+/**
+ * Sampling clock tuning
+ * The cmd and dat lines run through a delay line of `NumTaps` clk_i cycles before they reach
+ * rsp_read / dat_read. Picking a tap moves the point where the lines are sampled relative to
+ * sd_clk, tap 0 is the untuned sampling point.
+ *
+ * Writing `execute_tuning` restarts the engine at tap 0. Every tuning block the card sends
+ * (CMD19 / CMD21) is checked by dat_wrap and moves the engine to the next tap. After the last
+ * tap the centre of the longest run of passing taps is kept, `sampling_clock_select` tells
+ * whether one was found and `execute_tuning` is cleared.
+ *
+ * The delay has a resolution of one clk_i cycle, so it only covers the sd_clk period while
+ * sd_clk is divided down from clk_i.
+ */
+
+`include "common_cells/registers.svh"
+`include "defines.svh"
+
+module sdhci_tuning #(
+  parameter int unsigned NumTaps = 8, // at least 2
+  localparam int unsigned TapWidth = $clog2(NumTaps)
+) (
+  input  logic clk_i,
+  input  logic rst_ni,
+
+  input  logic       sd_cmd_i,
+  input  logic [7:0] sd_dat_i,
+  output logic       sd_cmd_o,
+  output logic [7:0] sd_dat_o,
+
+  input  logic execute_tuning_i,
+  input  logic sampling_clock_select_i,
+
+  input  logic block_done_i,
+  input  logic block_ok_i,
+
+  output `writable_reg_t() execute_tuning_o,
+  output `writable_reg_t() sampling_clock_select_o
+);
+
+  ////////////////
+  // Delay Line //
+  ////////////////
+
+  logic [NumTaps-1:1][8:0] delayed_q;
+  logic [NumTaps-1:0][8:0] taps;
+  logic [TapWidth-1:0] tap;
+
+  `FF(delayed_q[1], { sd_cmd_i, sd_dat_i }, '1);
+  for (genvar i = 2; i < NumTaps; i++) begin : gen_delay
+    `FF(delayed_q[i], delayed_q[i-1], '1);
+  end
+
+  assign taps = { delayed_q, { sd_cmd_i, sd_dat_i } };
+  assign { sd_cmd_o, sd_dat_o } = taps[tap];
+
+  ///////////////////
+  // Tuning Engine //
+  ///////////////////
+
+  logic tuning_q;
+  `FF(tuning_q, execute_tuning_i, '0);
+
+  logic [TapWidth-1:0] tap_q, tap_d, best_q, best_d;
+  `FF(tap_q, tap_d, '0);
+  `FF(best_q, best_d, '0);
+
+  logic [NumTaps-1:0] pass_q, pass_d;
+  `FF(pass_q, pass_d, '0);
+
+  // Centre of the longest run of passing taps, 0 if none passed
+  function automatic logic [TapWidth-1:0] window_centre(logic [NumTaps-1:0] pass);
+    int unsigned run_start, run_len, best_start, best_len;
+    run_start  = 0;
+    run_len    = 0;
+    best_start = 0;
+    best_len   = 0;
+    for (int unsigned i = 0; i < NumTaps; i++) begin
+      if (pass[i]) begin
+        if (run_len == 0) run_start = i;
+        run_len++;
+        if (run_len > best_len) begin
+          best_start = run_start;
+          best_len   = run_len;
+        end
+      end else begin
+        run_len = 0;
+      end
+    end
+    return (best_len == 0) ? '0 : TapWidth'(best_start + (best_len - 1) / 2);
+  endfunction
+
+  always_comb begin : tuning_fsm
+    tap_d  = tap_q;
+    best_d = best_q;
+    pass_d = pass_q;
+
+    execute_tuning_o        = '{ de: '0, d: '0 };
+    sampling_clock_select_o = '{ de: '0, d: '0 };
+
+    if (execute_tuning_i && !tuning_q) begin
+      tap_d  = '0;
+      pass_d = '0;
+      sampling_clock_select_o = '{ de: '1, d: '0 };
+    end else if (execute_tuning_i && block_done_i) begin
+      pass_d[tap_q] = block_ok_i;
+      if (tap_q == TapWidth'(NumTaps - 1)) begin
+        best_d = window_centre(pass_d);
+        execute_tuning_o        = '{ de: '1, d: '0 };
+        sampling_clock_select_o = '{ de: '1, d: |pass_d };
+      end else begin
+        tap_d = tap_q + 1;
+      end
+    end
+  end
+
+  always_comb begin : tap_select
+    if (execute_tuning_i) begin
+      tap = tap_q;
+    end else if (sampling_clock_select_i) begin
+      tap = best_q;
+    end else begin
+      tap = '0;
+    end
+  end
+
+endmodule
@@ -11,6 +11,10 @@
  * Asserting `pop_front_i` tries to put the next word into `read_data_o` within one clock cycle
  * If a push is happening at the same time the pop is delayed by a clock cycle
  * The first push (when empty_o = '1) takes 2 clock cycles to appear in the `front_data_o`
+ *
+ * With `DualPort` the SRAM gets a write and a read port. Pushes and pops then never wait for each
+ * other, and the read port already fetches the next word while popping, so a pop every cycle
+ * keeps `front_data_o` current. A word pushed while it becomes the front still takes 2 cycles.
  */
 
 `ifdef VERILATOR
@@ -24,7 +28,8 @@ module sram_shift_reg #(
   parameter int unsigned NumWords     = 1024,
   parameter int unsigned DataWidth    = 32,
   parameter int unsigned AddrWidth    = cf_math_pkg::idx_width(NumWords),
-  parameter int unsigned LengthWidth  = cf_math_pkg::idx_width(NumWords + 1)
+  parameter int unsigned LengthWidth  = cf_math_pkg::idx_width(NumWords + 1),
+  parameter bit          DualPort     = 1'b0
 ) (
   input  logic clk_i,
   input  logic rst_ni,
@@ -43,9 +48,11 @@ module sram_shift_reg #(
   // Push a pop operation to the next clock cycle if the sram is busy
   logic pop_front_q, pop_front_d;
   `FF(pop_front_q, pop_front_d, '0, clk_i, rst_ni);
-  assign pop_front_d = pop_front_i & (push_back_i | pop_front_q);
+  assign pop_front_d = !DualPort & pop_front_i & (push_back_i | pop_front_q);
 
   `ASSERT_NEVER(Overload, pop_front_i & push_back_i & pop_front_q);
+  // the read address wraps with a plain subtraction
+  `ASSERT_INIT(NumWordsPow2, NumWords == 2 ** AddrWidth);
 
   logic [AddrWidth-1:0] back_addr_q, back_addr_d;
   `FF(back_addr_q, back_addr_d, '0, clk_i, rst_ni);
@@ -59,6 +66,11 @@ module sram_shift_reg #(
 
     if (!en_i) begin
       length_d = '0;
+    end else if (DualPort) begin
+      length_d = length_q + LengthWidth'(push_back_i) - LengthWidth'(pop_front_i);
+      if (push_back_i) begin
+        back_addr_d = AddrWidth'((back_addr_q + 1) % NumWords);
+      end
     end else if (push_back_i) begin
       length_d = length_q + 1;
       back_addr_d = AddrWidth'((back_addr_q + 1) % NumWords);
@@ -72,26 +84,54 @@ module sram_shift_reg #(
   assign length_o = length_q;
 
   `ASSERT_NEVER(Underflow, (pop_front_i || pop_front_q) && empty_o);
-  `ASSERT_NEVER(Overflow,  push_back_i && full_o);
-
-  tc_sram_impl #(
-    .NumWords  ( NumWords ),
-    .DataWidth ( DataWidth ),
-    .NumPorts  ( 1 ),
-    .Latency   ( 1 )
-  ) i_sram (
-    .clk_i,
-    .rst_ni,
-
-    .impl_i  ('1),
-    .impl_o  ( ),
-
-    .req_i   (en_i),
-    .we_i    (push_back_i),
-    .addr_i  (push_back_i ? back_addr_q : AddrWidth'((back_addr_q - length_q) % NumWords)),
-
-    .wdata_i (back_data_i),
-    .be_i    ('1),
-    .rdata_o (front_data_o)
-  );
+  `ASSERT_NEVER(Overflow,  push_back_i && full_o && !(DualPort && pop_front_i));
+
+  logic [AddrWidth-1:0] front_addr;
+  logic [DataWidth-1:0] unused_rdata;
+  assign front_addr = AddrWidth'((back_addr_q - length_q) % NumWords);
+
+  if (DualPort) begin : gen_dual_port
+    tc_sram_impl #(
+      .NumWords  ( NumWords ),
+      .DataWidth ( DataWidth ),
+      .NumPorts  ( 2 ),
+      .Latency   ( 1 )
+    ) i_sram (
+      .clk_i,
+      .rst_ni,
+
+      .impl_i  ('1),
+      .impl_o  ( ),
+
+      // port 0 writes the back, port 1 reads the front, or the word after it while popping
+      .req_i   ({en_i, push_back_i}),
+      .we_i    ({1'b0, push_back_i}),
+      .addr_i  ({pop_front_i ? AddrWidth'((front_addr + 1) % NumWords) : front_addr, back_addr_q}),
+
+      .wdata_i ({{DataWidth{1'b0}}, back_data_i}),
+      .be_i    ('1),
+      .rdata_o ({front_data_o, unused_rdata})
+    );
+  end else begin : gen_single_port
+    tc_sram_impl #(
+      .NumWords  ( NumWords ),
+      .DataWidth ( DataWidth ),
+      .NumPorts  ( 1 ),
+      .Latency   ( 1 )
+    ) i_sram (
+      .clk_i,
+      .rst_ni,
+
+      .impl_i  ('1),
+      .impl_o  ( ),
+
+      .req_i   (en_i),
+      .we_i    (push_back_i),
+      .addr_i  (push_back_i ? back_addr_q : front_addr),
+
+      .wdata_i (back_data_i),
+      .be_i    ('1),
+      .rdata_o (front_data_o)
+    );
+  end
 endmodule
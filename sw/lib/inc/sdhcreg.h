@@ -30,13 +30,16 @@
 
 /* Host standard register set */
 #define SDHC_DMA_ADDR			0x00
+#define SDHC_ARGUMENT2			0x00	/* Auto CMD23, shared with SDMA */
 #define SDHC_BLOCK_SIZE			0x04
+#define  SDHC_SDMA_BOUNDARY_512K	(7<<12)
 #define SDHC_BLOCK_COUNT		0x06
-#define  SDHC_BLOCK_COUNT_MAX		512
+#define  SDHC_BLOCK_COUNT_MAX		65535
 #define SDHC_ARGUMENT			0x08
 #define SDHC_TRANSFER_MODE		0x0c
 #define  SDHC_MULTI_BLOCK_MODE		(1<<5)
 #define  SDHC_READ_MODE			(1<<4)
+#define  SDHC_AUTO_CMD23_ENABLE		(1<<3)
 #define  SDHC_AUTO_CMD12_ENABLE		(1<<2)
 #define  SDHC_BLOCK_COUNT_ENABLE	(1<<1)
 #define  SDHC_DMA_ENABLE		(1<<0)
@@ -96,6 +99,10 @@
 #define   SDHC_VOLTAGE_1_8V		0x05
 #define  SDHC_BUS_POWER			(1<<0)
 #define SDHC_BLOCK_GAP_CTL		0x2a
+#define  SDHC_INTR_AT_BLOCK_GAP		(1<<3)
+#define  SDHC_READ_WAIT_CTL		(1<<2)
+#define  SDHC_CONTINUE_REQUEST		(1<<1)
+#define  SDHC_STOP_AT_BLOCK_GAP		(1<<0)
 #define SDHC_WAKEUP_CTL			0x2b
 #define SDHC_CLOCK_CTL			0x2c
 #define  SDHC_SDCLK_DIV_SHIFT		8
@@ -196,6 +203,24 @@
 #define  SDHC_ADMA_LENGTH_MISMATCH	(1<<2)
 #define  SDHC_ADMA_ERROR_STATE		(3<<0)
 #define SDHC_ADMA_SYSTEM_ADDR		0x58
+#define SDHC_ADMA_SYSTEM_ADDR_HI	0x5c
+#define SDHC_CMD_QUEUE_STATUS		0xc0	/* vendor */
+#define  SDHC_CMD_QUEUE_FREE_MASK	0xff
+#define SDHC_DATA_WINDOW_WIDTH		0xc4	/* vendor, bytes per access */
+#define SDHC_DATA_WINDOW		0x200	/* vendor, aliases SDHC_DATA */
+#define SDHC_DATA_WINDOW_SIZE		0x200
+#define SDHC_INTR_COALESCING		0xc8	/* vendor */
+#define  SDHC_INTR_COALESCING_EVENTS_SHIFT	0
+#define  SDHC_INTR_COALESCING_EVENTS_MASK	0xff
+#define  SDHC_INTR_COALESCING_TIMEOUT_SHIFT	16
+#define  SDHC_INTR_COALESCING_TIMEOUT_MASK	0xffff
+#define SDHC_BUFFER_CTL			0xcc	/* vendor */
+#define  SDHC_WRITE_PREFILL		(1<<0)
+#define  SDHC_CUT_THROUGH_SHIFT		8
+#define  SDHC_CUT_THROUGH_MASK		0xff
+#define  SDHC_READ_WATERMARK_SHIFT	16
+#define  SDHC_WRITE_WATERMARK_SHIFT	24
+#define  SDHC_WATERMARK_MASK		0xff
 #define SDHC_MAX_CAPABILITIES		0x48
 #define SDHC_SLOT_INTR_STATUS		0xfc
 #define SDHC_HOST_CTL_VERSION		0xfe
@@ -243,7 +268,7 @@
 	"\20\20ERROR\11CARD\10REMOVAL\7INSERTION\6READ\5WRITE"		\
 	"\4DMA\3GAP\2XFER\1CMD"
 #define SDHC_EINTR_STATUS_BITS						\
-	"\20\11ACMD12\10CL\7DEB\6DCRC\5DT\4CI\3CEB\2CCRC\1CT"
+	"\20\12ADMA\11ACMD12\10CL\7DEB\6DCRC\5DT\4CI\3CEB\2CCRC\1CT"
 #define SDHC_CAPABILITIES_BITS						\
 	"\20\33Vdd1.8V\32Vdd3.0V\31Vdd3.3V\30SUSPEND\27DMA\26HIGHSPEED"
 
@@ -254,6 +279,8 @@
 #define SDHC_ADMA2_ACT_NOP	(0<<4)
 #define SDHC_ADMA2_ACT_TRANS	(2<<4)
 #define SDHC_ADMA2_ACT_LINK	(3<<4)
+/* A descriptor moves at most 64K, a length of 0 encodes 64K. */
+#define SDHC_ADMA2_MAX_LEN	((size_t)65536)
 
 struct sdhc_adma2_descriptor32 {
 	uint16_t	attribute;
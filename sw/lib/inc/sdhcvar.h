@@ -21,6 +21,16 @@
 
 #include "types.h"
 
+struct sdhc_host;
+struct sdmmc_command;
+
+/* Seconds to wait for a data transfer, also used by sdmmc_mem */
+#define SDHC_TRANSFER_TIMEOUT	1
+
+/* Completion callback of sdhc_submit_command(), called from sdhc_intr() */
+typedef void (*sdhc_done_t)(struct sdhc_host *, struct sdmmc_command *,
+    void *);
+
 struct sdhc_host {
 	u_int mmio;
 
@@ -28,15 +38,50 @@ struct sdhc_host {
 	u_int clkbase;			/* base clock frequency in KHz */
 	int maxblklen;			/* maximum block length */
 	int flags;			/* flags for this host */
+	u_int winwidth;			/* buffer data window access, bytes */
+	u_int32_t bufctl;		/* SDHC_BUFFER_CTL, kept across resets */
 #define SDHC_F_NOPWR0		(1 << 0)
 #define SDHC_F_NONREMOVABLE	(1 << 1)
 #define SDHC_F_NO_HS_BIT	(1 << 3)
-	u_int16_t intr_status;		/* soft interrupt status */
-	u_int16_t intr_error_status;	/* soft error status */
+#define SDHC_F_SDMA		(1 << 4)	/* use SDMA for word aligned buffers */
+#define SDHC_F_ADMA2		(1 << 5)	/* use ADMA2 instead of SDMA */
+#define SDHC_F_ADMA64		(1 << 6)	/* use 64-bit ADMA2 descriptors */
+#define SDHC_F_AUTO_CMD23	(1 << 7)	/* controller can send CMD23 itself */
+#define SDHC_F_8BIT		(1 << 8)	/* 8-bit data bus for eMMC */
+#define SDHC_F_DDR50		(1 << 9)	/* dual data rate transfers */
+#define SDHC_F_SDR50		(1 << 10)	/* UHS-I SDR50 */
+#define SDHC_F_SDR104		(1 << 11)	/* UHS-I SDR104 */
+#define SDHC_F_TUNING_SDR50	(1 << 12)	/* SDR50 needs tuning as well */
+#define SDHC_F_10BIT_DIV	(1 << 13)	/* any even SDCLK divisor */
+#define SDHC_F_HIGHSPEED	(1 << 14)	/* SD high speed / MMC 52 MHz */
+#define SDHC_F_PREFILL		(1 << 15)	/* PIO writes fill the buffer early */
+#define SDHC_F_VENDOR_REGS	(1 << 16)	/* this controller, set by the attachment */
+	/* also written by sdhc_intr() */
+	volatile u_int16_t intr_status;		/* soft interrupt status */
+	volatile u_int16_t intr_error_status;	/* soft error status */
 
 	uint16_t block_size;
 	uint16_t block_count;
 	uint16_t transfer_mode;
+
+#define SDHC_ADMA2_NDESC	32
+	/* ADMA2 descriptor table, large enough for 64-bit descriptors */
+	uint8_t adma2[SDHC_ADMA2_NDESC * 12] __aligned(8);
+
+	/* Command submitted with sdhc_submit_command(), NULL if none */
+	struct sdmmc_command *intr_cmd;
+	sdhc_done_t intr_done;
+	void *intr_arg;
+	u_char *intr_datap;		/* PIO position */
+	int intr_datalen;		/* PIO bytes left */
+	int intr_suspend;		/* see sdhc_suspend_command() */
+	/* Called while the driver busy waits on the controller, or NULL */
+	void (*intr_poll)(struct sdhc_host *);
+
+	int prefilled;			/* PIO bytes written ahead of the command */
+#define SDHC_SUSPEND_NONE	0
+#define SDHC_SUSPEND_AT_GAP	1	/* stopping at the next block gap */
+#define SDHC_SUSPEND_STOPPING	2	/* suspend CMD12 sent */
 };
 
 int	sdhc_init(struct sdhc_host *hp, u_int mmio, uint64_t capmask, uint64_t capset);
@@ -55,11 +100,25 @@ int	sdhc_bus_width(struct sdhc_host*, int);
 void	sdhc_card_intr_mask(struct sdhc_host*, int);
 void	sdhc_card_intr_ack(struct sdhc_host*);
 int	sdhc_signal_voltage(struct sdhc_host*, int);
+int	sdhc_execute_tuning(struct sdhc_host *, int);
 void	sdhc_exec_command(struct sdhc_host*, struct sdmmc_command *);
+void	sdhc_exec_command_chain(struct sdhc_host *, struct sdmmc_command *, int);
+int	sdhc_submit_command(struct sdhc_host *, struct sdmmc_command *,
+	    sdhc_done_t, void *);
+int	sdhc_intr(struct sdhc_host *);
+int	sdhc_suspend_command(struct sdhc_host *);
+int	sdhc_stream_start(struct sdhc_host *, struct sdmmc_command *);
+int	sdhc_stream_write(struct sdhc_host *, u_char *, int);
+int	sdhc_stream_stop(struct sdhc_host *);
+int	sdhc_intr_coalescing(struct sdhc_host *, int, int);
+int	sdhc_write_cut_through(struct sdhc_host *, int);
+int	sdhc_buffer_watermarks(struct sdhc_host *, int, int);
+void	sdhc_read_response(struct sdhc_host *, struct sdmmc_command *);
 int	sdhc_start_command(struct sdhc_host *, struct sdmmc_command *);
 int	sdhc_wait_state(struct sdhc_host *, u_int32_t, u_int32_t);
 int	sdhc_soft_reset(struct sdhc_host *, int);
 int	sdhc_wait_intr(struct sdhc_host *, int, int);
 void	sdhc_transfer_data(struct sdhc_host *, struct sdmmc_command *);
+int	sdhc_transfer_dma(struct sdhc_host *);
 void	sdhc_read_data(struct sdhc_host *, u_char *, int);
 void	sdhc_write_data(struct sdhc_host *, u_char *, int);
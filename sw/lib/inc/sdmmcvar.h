@@ -36,10 +36,22 @@ struct sdmmc_csd {
 struct sdmmc_scr {
 	int	sd_spec;
 	int	bus_width;
+	int	cmd23;		/* SET_BLOCK_COUNT supported */
 };
 
 typedef u_int32_t sdmmc_response[4];
 
+/* Scatter list of a DMA transfer, every segment has to be word aligned. */
+struct sdmmc_dma_segment {
+	void		*ds_addr;	/* start of the segment */
+	size_t		 ds_len;	/* length in bytes */
+};
+
+struct sdmmc_dmamap {
+	struct sdmmc_dma_segment *dm_segs;
+	int		 dm_nsegs;
+};
+
 struct sdmmc_softc;
 
 struct sdmmc_command {
@@ -48,7 +60,11 @@ struct sdmmc_command {
 	sdmmc_response	 	c_resp;	/* response buffer */
 	void		*c_data;	/* buffer to send or read into */
 	int		 c_datalen;	/* length of data buffer */
+	struct sdmmc_dmamap *c_dmamap;	/* scatter list, overrides c_data */
 	int		 c_blklen;	/* block length */
+	int		 c_argstep;	/* c_arg increment per block, 0 if
+					   the command can not be split */
+	int		 c_resid;	/* bytes not transferred */
 	int		 c_flags;	/* see below */
 #define SCF_ITSDONE	 0x0001		/* command is complete */
 #define SCF_CMD(flags)	 ((flags) & 0x00f0)
@@ -57,6 +73,9 @@ struct sdmmc_command {
 #define SCF_CMD_BC	 0x0020
 #define SCF_CMD_BCR	 0x0030
 #define SCF_CMD_READ	 0x0040		/* read command (data expected) */
+#define SCF_AUTO_CMD23	 0x2000		/* announce the block count with CMD23 */
+#define SCF_SUSPENDED	 0x4000		/* stopped at a block gap, c_resid left */
+#define SCF_OPEN_ENDED	 0x8000		/* multi block without a block count */
 #define SCF_RSP_BSY	 0x0100
 #define SCF_RSP_136	 0x0200
 #define SCF_RSP_CRC	 0x0400
@@ -90,11 +109,50 @@ struct sdmmc_function {
 	int flags;
 #define SFF_SDHC		0x0002	/* SD High Capacity card */
 	unsigned int cur_blklen;	/* current block length */
+	size_t resid;			/* not transferred by the last
+					   block read or write */
 	/* SD/MMC memory card members */
 	struct sdmmc_csd csd;		/* decoded CSD value */
 	struct sdmmc_scr scr;		/* decoded SCR value */
 };
 
+/*
+ * Block transfer started with sdmmc_mem_start_block(), driven by
+ * sdhc_intr().  blkno, data and datalen move along when it is
+ * suspended, so they always describe what is left.
+ */
+struct sdmmc_mem_xfer {
+	struct sdmmc_function *sf;
+	struct sdmmc_command cmd;
+	int		 read;
+	int		 blkno;
+	u_char		*data;
+	size_t		 datalen;
+	int		 error;
+	volatile int	 state;
+#define SDMMC_XFER_RUNNING	0
+#define SDMMC_XFER_SUSPENDED	1
+#define SDMMC_XFER_DONE		2
+};
+
+/*
+ * Block stream written with a single open ended CMD25, see
+ * sdmmc_stream_open().  The ring is filled by sdmmc_stream_append() and
+ * drained into the controller a block at a time.
+ */
+struct sdmmc_stream {
+	struct sdmmc_function *sf;
+	struct sdmmc_command cmd;	/* the running CMD25 */
+	u_char		*ring;
+	size_t		 ringlen;	/* a multiple of the block length */
+	size_t		 head;		/* next byte appended */
+	size_t		 tail;		/* next byte handed to the controller */
+	size_t		 count;		/* bytes in the ring */
+	int		 blkno;		/* card block of the byte at tail */
+	int		 running;	/* CMD25 issued */
+	int		 error;
+};
+
 /*
  * Structure describing a single SD/MMC/SDIO card slot.
  */
@@ -159,6 +217,16 @@ int	sdmmc_mem_scan(struct sdmmc_softc *);
 int	sdmmc_mem_init(struct sdmmc_softc *, struct sdmmc_function *);
 int	sdmmc_mem_read_block(struct sdmmc_function *, int, u_char *, size_t);
 int	sdmmc_mem_write_block(struct sdmmc_function *, int, u_char *, size_t);
+int	sdmmc_mem_read_block_sg(struct sdmmc_function *, int, struct sdmmc_dmamap *);
+int	sdmmc_mem_write_block_sg(struct sdmmc_function *, int, struct sdmmc_dmamap *);
+int	sdmmc_mem_start_block(struct sdmmc_function *, struct sdmmc_mem_xfer *,
+	    int, int, u_char *, size_t);
+int	sdmmc_mem_preempt_read(struct sdmmc_mem_xfer *, int, u_char *, size_t);
+int	sdmmc_stream_open(struct sdmmc_stream *, struct sdmmc_function *, int,
+	    u_char *, size_t);
+int	sdmmc_stream_append(struct sdmmc_stream *, const u_char *, size_t);
+int	sdmmc_stream_flush(struct sdmmc_stream *);
+int	sdmmc_stream_close(struct sdmmc_stream *);
 int	sdmmc_mem_set_blocklen(struct sdmmc_softc *, struct sdmmc_function *);
 int sdmmc_select_card(struct sdmmc_softc *, struct sdmmc_function *);
 
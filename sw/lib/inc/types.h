@@ -33,6 +33,7 @@ typedef uint64_t u_int64_t;
 #define EIO 3
 #define ENOMEM 4
 #define ENODEV 5
+#define EBUSY 16
 
 #define	UINT_MAX	0xffffffffU
 #define	INT_MAX		0x7fffffff
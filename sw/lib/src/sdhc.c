@@ -33,15 +33,19 @@
 /* Timeouts in seconds */
 #define SDHC_COMMAND_TIMEOUT	1
 #define SDHC_BUFFER_TIMEOUT	1
-#define SDHC_TRANSFER_TIMEOUT	1
 #define SDHC_DMA_TIMEOUT	3
 
 
 /* flag values */
-#define SHF_USE_DMA		0x0001
-#define SHF_USE_DMA64		0x0002
 #define SHF_USE_32BIT_ACCESS	0x0004
 
+/* The DMA engines need word aligned system memory. */
+#define SDHC_DMA_ALIGNED(addr, len)					\
+	((((uintptr_t)(addr) | (len)) & 3) == 0)
+/* SDMA and 32-bit ADMA2 only take a 32-bit system address. */
+#define SDHC_DMA_32BIT(addr, len)					\
+	((uint64_t)(uintptr_t)(addr) + (len) <= 0x100000000ULL)
+
 #define HREAD1(hp, reg)							\
 	(sdhc_read_1((hp), (reg)))
 #define HREAD2(hp, reg)							\
@@ -63,6 +67,11 @@
 #define HSET2(hp, reg, bits)						\
 	HWRITE2((hp), (reg), HREAD2((hp), (reg)) | (bits))
 
+static u_int16_t sdhc_command_word(struct sdmmc_command *);
+static void	sdhc_exec_command_1(struct sdhc_host *, struct sdmmc_command *);
+static int	sdhc_pio_len(struct sdhc_host *, struct sdmmc_command *, int,
+		    int);
+
 #ifdef SDHC_DEBUG
 int sdhcdebug = 2;
 int debug_funcs = 0;
@@ -113,7 +122,7 @@ sdhc_init(struct sdhc_host *hp, u_int mmio, uint64_t capmask, uint64_t capset)
 {
 	DFUNC(sdhc_init);
 
-	uint32_t caps;
+	uint32_t caps, caps2;
 	int major, minor;
 	int error = 1;
 	int max_clock;
@@ -133,6 +142,66 @@ sdhc_init(struct sdhc_host *hp, u_int mmio, uint64_t capmask, uint64_t capset)
 	caps &= ~capmask;
 	caps |= capset;
 
+	if (ISSET(caps, SDHC_HIGH_SPEED_SUPP))
+		SET(hp->flags, SDHC_F_HIGHSPEED);
+	if (ISSET(caps, SDHC_SDMA_SUPP))
+		SET(hp->flags, SDHC_F_SDMA);
+	if (ISSET(caps, SDHC_ADMA2_SUPP)) {
+		SET(hp->flags, SDHC_F_ADMA2);
+		if (ISSET(caps, SDHC_64BIT_DMA_SUPP))
+			SET(hp->flags, SDHC_F_ADMA64);
+	}
+	/*
+	 * Auto CMD23 came with the v3 interface, this controller sends it
+	 * ahead of that.  Only the attachment can tell it apart from other
+	 * 2.00 hosts, with SDHC_F_VENDOR_REGS.
+	 */
+	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3 ||
+	    ISSET(hp->flags, SDHC_F_VENDOR_REGS))
+		SET(hp->flags, SDHC_F_AUTO_CMD23);
+	/*
+	 * This controller takes a 10-bit clock divisor ahead of the v3
+	 * interface.  PIO writes may fill its buffer before the command
+	 * goes out.
+	 */
+	if (ISSET(hp->flags, SDHC_F_VENDOR_REGS)) {
+		SET(hp->flags, SDHC_F_10BIT_DIV | SDHC_F_PREFILL);
+		hp->bufctl |= SDHC_WRITE_PREFILL;
+		HWRITE4(hp, SDHC_BUFFER_CTL, hp->bufctl);
+	}
+	/* The 8-bit bus is reported even though the version is 2.00. */
+	if (ISSET(caps, SDHC_8BIT_MODE_SUPP))
+		SET(hp->flags, SDHC_F_8BIT);
+	/*
+	 * The buffer data window pops or pushes a whole bus word per
+	 * access, PIO only uses it if the CPU never splits such a word.
+	 */
+	hp->winwidth = 0;
+	if (ISSET(hp->flags, SDHC_F_VENDOR_REGS))
+		hp->winwidth = HREAD1(hp, SDHC_DATA_WINDOW_WIDTH);
+	if (hp->winwidth > sizeof(long))
+		hp->winwidth = 0;
+
+	/*
+	 * The second capabilities register came with v3.  This controller
+	 * reports the UHS-I modes and the tuning engine they rely on there
+	 * even though its version is 2.00.
+	 */
+	caps2 = 0;
+	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3 ||
+	    ISSET(hp->flags, SDHC_F_VENDOR_REGS))
+		caps2 = HREAD4(hp, SDHC_CAPABILITIES2);
+	caps2 &= ~(capmask >> 32);
+	caps2 |= capset >> 32;
+	if (ISSET(caps2, SDHC_DDR50_SUPP))
+		SET(hp->flags, SDHC_F_DDR50);
+	if (ISSET(caps2, SDHC_SDR50_SUPP))
+		SET(hp->flags, SDHC_F_SDR50);
+	if (ISSET(caps2, SDHC_SDR104_SUPP))
+		SET(hp->flags, SDHC_F_SDR104);
+	if (ISSET(caps2, SDHC_TUNING_SDR50))
+		SET(hp->flags, SDHC_F_TUNING_SDR50);
+
 	/*
 	 * Determine the base clock frequency. (2.2.24)
 	 */
@@ -229,6 +298,9 @@ sdhc_host_reset(struct sdhc_host* hp)
 	/* Set data timeout counter value to max for now. */
 	HWRITE1(hp, SDHC_TIMEOUT_CTL, SDHC_TIMEOUT_MAX);
 
+	if (ISSET(hp->flags, SDHC_F_VENDOR_REGS))
+		HWRITE4(hp, SDHC_BUFFER_CTL, hp->bufctl);
+
 	/* Enable interrupts. */
 	imask = SDHC_CARD_REMOVAL | SDHC_CARD_INSERTION |
 	    SDHC_BUFFER_READ_READY | SDHC_BUFFER_WRITE_READY |
@@ -270,7 +342,8 @@ sdhc_clock_divisor(struct sdhc_host *hp, u_int freq)
 
 	int div;
 
-	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3) {
+	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3 ||
+	    ISSET(hp->flags, SDHC_F_10BIT_DIV)) {
 		if (hp->clkbase <= freq)
 			return 0;
 
@@ -325,10 +398,17 @@ sdhc_bus_clock(struct sdhc_host* hp, int freq, int timing)
 			HSET1(hp, SDHC_HOST_CTL, SDHC_HIGH_SPEED);
 	}
 
-	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3) {
+	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3 ||
+	    ISSET(hp->flags, SDHC_F_DDR50 | SDHC_F_SDR50 | SDHC_F_SDR104)) {
+		HCLR2(hp, SDHC_HOST_CTL2, SDHC_UHS_MODE_SELECT_MASK);
 		switch (timing) {
+		case SDMMC_TIMING_UHS_SDR50:
+			HSET2(hp, SDHC_HOST_CTL2, SDHC_UHS_MODE_SELECT_SDR50);
+			break;
+		case SDMMC_TIMING_UHS_SDR104:
+			HSET2(hp, SDHC_HOST_CTL2, SDHC_UHS_MODE_SELECT_SDR104);
+			break;
 		case SDMMC_TIMING_MMC_DDR52:
-			HCLR2(hp, SDHC_HOST_CTL2, SDHC_UHS_MODE_SELECT_MASK);
 			HSET2(hp, SDHC_HOST_CTL2, SDHC_UHS_MODE_SELECT_DDR50);
 			break;
 		}
@@ -342,7 +422,12 @@ sdhc_bus_clock(struct sdhc_host* hp, int freq, int timing)
 		error = EINVAL;
 		goto ret;
 	}
-	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3)
+	/* Both SDCLK edges are sampled with the base clock, so DDR needs a divisor. */
+	if (timing == SDMMC_TIMING_MMC_DDR52 && ISSET(hp->flags, SDHC_F_DDR50) &&
+	    div == 0)
+		div = 1;
+	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3 ||
+	    ISSET(hp->flags, SDHC_F_10BIT_DIV))
 		sdclk = SDHC_SDCLK_DIV_V3(div);
 	else
 		sdclk = SDHC_SDCLK_DIV(div);
@@ -388,13 +473,15 @@ sdhc_bus_width(struct sdhc_host* hp, int width)
 
 	reg = HREAD1(hp, SDHC_HOST_CTL);
 	reg &= ~SDHC_4BIT_MODE;
-	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3) {
+	if (SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3 ||
+	    ISSET(hp->flags, SDHC_F_8BIT)) {
 		reg &= ~SDHC_8BIT_MODE;
 	}
 	if (width == 4) {
 		reg |= SDHC_4BIT_MODE;
 	} else if (width == 8) {
-		KASSERT(SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3);
+		KASSERT(SDHC_SPEC_VERSION(hp->version) >= SDHC_SPEC_V3 ||
+		    ISSET(hp->flags, SDHC_F_8BIT));
 		reg |= SDHC_8BIT_MODE;
 	}
 	HWRITE1(hp, SDHC_HOST_CTL, reg);
@@ -431,7 +518,8 @@ sdhc_signal_voltage(struct sdhc_host* hp, int signal_voltage)
 {
 	DFUNC(sdhc_signal_voltage);
 
-	if (SDHC_SPEC_VERSION(hp->version) < SDHC_SPEC_V3)
+	if (SDHC_SPEC_VERSION(hp->version) < SDHC_SPEC_V3 &&
+	    !ISSET(hp->flags, SDHC_F_SDR50 | SDHC_F_SDR104))
 		return EINVAL;
 
 	switch (signal_voltage) {
@@ -456,6 +544,90 @@ sdhc_signal_voltage(struct sdhc_host* hp, int signal_voltage)
 	return 0;
 }
 
+/*
+ * Let the host controller find a sampling point for the current timing.
+ * Tuning blocks are read with the CPU, but never land in the buffer;
+ * every one of them raises buffer read ready instead. (2.2.18)
+ */
+int
+sdhc_execute_tuning(struct sdhc_host *hp, int timing)
+{
+	DFUNC(sdhc_execute_tuning);
+
+	struct sdmmc_command cmd;
+	u_int8_t hostctl;
+	int opcode, status, error, retry = 40;
+
+	switch (timing) {
+	case SDMMC_TIMING_MMC_HS200:
+		opcode = MMC_SEND_TUNING_BLOCK_HS200;
+		break;
+	case SDMMC_TIMING_UHS_SDR50:
+		if (!ISSET(hp->flags, SDHC_F_TUNING_SDR50))
+			return 0;
+		/* FALLTHROUGH */
+	case SDMMC_TIMING_UHS_SDR104:
+		opcode = MMC_SEND_TUNING_BLOCK;
+		break;
+	default:
+		return EINVAL;
+	}
+
+	hostctl = HREAD1(hp, SDHC_HOST_CTL);
+
+	/* Reset the tuning circuit and start tuning. */
+	HCLR2(hp, SDHC_HOST_CTL2, SDHC_SAMPLING_CLOCK_SEL);
+	HSET2(hp, SDHC_HOST_CTL2, SDHC_EXECUTE_TUNING);
+
+	error = 0;
+	do {
+		bzero(&cmd, sizeof(cmd));
+		cmd.c_opcode = opcode;
+		cmd.c_arg = 0;
+		cmd.c_flags = SCF_CMD_ADTC | SCF_CMD_READ | SCF_RSP_R1;
+		if (ISSET(hostctl, SDHC_8BIT_MODE))
+			cmd.c_blklen = cmd.c_datalen = 128;
+		else
+			cmd.c_blklen = cmd.c_datalen = 64;
+
+		if ((error = sdhc_start_command(hp, &cmd)) != 0)
+			break;
+
+		/* A bad sampling point may also garble the response. */
+		status = sdhc_wait_intr(hp, SDHC_BUFFER_READ_READY,
+		    SDHC_BUFFER_TIMEOUT);
+		if (!ISSET(status, SDHC_BUFFER_READ_READY) &&
+		    ISSET(status, SDHC_ERROR_INTERRUPT)) {
+			(void)sdhc_soft_reset(hp, SDHC_RESET_CMD);
+			status = sdhc_wait_intr(hp, SDHC_BUFFER_READ_READY,
+			    SDHC_BUFFER_TIMEOUT);
+		}
+		if (!ISSET(status, SDHC_BUFFER_READ_READY)) {
+			error = ETIMEDOUT;
+			break;
+		}
+		(void)sdhc_wait_intr(hp, SDHC_TRANSFER_COMPLETE,
+		    SDHC_TRANSFER_TIMEOUT);
+	} while (ISSET(HREAD2(hp, SDHC_HOST_CTL2), SDHC_EXECUTE_TUNING) &&
+	    --retry);
+
+	if (error == 0 &&
+	    ISSET(HREAD2(hp, SDHC_HOST_CTL2), SDHC_EXECUTE_TUNING))
+		error = ETIMEDOUT;
+	if (error == 0 &&
+	    !ISSET(HREAD2(hp, SDHC_HOST_CTL2), SDHC_SAMPLING_CLOCK_SEL))
+		error = EIO;
+
+	if (error != 0) {
+		HCLR2(hp, SDHC_HOST_CTL2,
+		    SDHC_SAMPLING_CLOCK_SEL | SDHC_EXECUTE_TUNING);
+		(void)sdhc_soft_reset(hp, SDHC_RESET_DAT | SDHC_RESET_CMD);
+		DPRINTF(0, ("%s: tuning failed\n", DEVNAME(hp->sc)));
+	}
+
+	return error;
+}
+
 int
 sdhc_wait_state(struct sdhc_host *hp, u_int32_t mask, u_int32_t value)
 {
@@ -475,11 +647,71 @@ sdhc_wait_state(struct sdhc_host *hp, u_int32_t mask, u_int32_t value)
 	return ETIMEDOUT;
 }
 
+/*
+ * Execute `cmd', splitting its data phase into as many maximal multi
+ * block commands as the 16-bit block count needs.  Only commands that
+ * say how their argument advances (c_argstep) are split.  A trailing
+ * partial block can not be addressed and fails with EINVAL.  c_resid
+ * tells how much data was not transferred.
+ */
 void
 sdhc_exec_command(struct sdhc_host* hp, struct sdmmc_command *cmd)
 {
 	DFUNC(sdhc_exec_command);
 
+	struct sdmmc_command piece;
+	size_t maxlen;
+	int resid;
+
+	maxlen = (size_t)SDHC_BLOCK_COUNT_MAX * cmd->c_blklen;
+	if (cmd->c_data == NULL || cmd->c_dmamap != NULL ||
+	    cmd->c_argstep == 0 || (cmd->c_datalen <= maxlen &&
+	    cmd->c_datalen % cmd->c_blklen == 0)) {
+		sdhc_exec_command_1(hp, cmd);
+		cmd->c_resid = cmd->c_error == 0 ? 0 : cmd->c_datalen;
+		return;
+	}
+
+	piece = *cmd;
+	resid = cmd->c_datalen;
+	while (resid >= cmd->c_blklen) {
+		piece.c_datalen = MIN(resid - resid % cmd->c_blklen, maxlen);
+		piece.c_flags = cmd->c_flags;
+		piece.c_error = 0;
+
+		DPRINTF(1,("%s: cmd %u piece arg=%#x len=%d\n",
+		    DEVNAME(hp->sc), piece.c_opcode, piece.c_arg,
+		    piece.c_datalen));
+
+		sdhc_exec_command_1(hp, &piece);
+		if (piece.c_error != 0)
+			break;
+
+		resid -= piece.c_datalen;
+		piece.c_data = (u_char *)piece.c_data + piece.c_datalen;
+		piece.c_arg += (piece.c_datalen / cmd->c_blklen) *
+		    cmd->c_argstep;
+	}
+
+	/* Hand back the response and status of the last piece. */
+	piece.c_data = cmd->c_data;
+	piece.c_datalen = cmd->c_datalen;
+	piece.c_arg = cmd->c_arg;
+	*cmd = piece;
+	if (cmd->c_error == 0 && resid > 0) {
+		DPRINTF(0, ("%s: data not a multiple of %d bytes\n",
+		    DEVNAME(hp->sc), cmd->c_blklen));
+		cmd->c_error = EINVAL;
+	}
+	cmd->c_resid = resid;
+	SET(cmd->c_flags, SCF_ITSDONE);
+}
+
+static void
+sdhc_exec_command_1(struct sdhc_host* hp, struct sdmmc_command *cmd)
+{
+	DFUNC(sdhc_exec_command_1);
+
 	int error;
 
 	/*
@@ -503,12 +735,94 @@ sdhc_exec_command(struct sdhc_host* hp, struct sdmmc_command *cmd)
 		return;
 	}
 
+	if (cmd->c_error == 0)
+		sdhc_read_response(hp, cmd);
+
 	/*
-	 * The host controller removes bits [0:7] from the response
-	 * data (CRC) and we pass the data up unchanged to the bus
-	 * driver (without padding).
+	 * If the command has data to transfer in any direction,
+	 * execute the transfer now.
 	 */
-	if (cmd->c_error == 0 && ISSET(cmd->c_flags, SCF_RSP_PRESENT)) {
+	if (cmd->c_error == 0 && cmd->c_data != NULL)
+		sdhc_transfer_data(hp, cmd);
+
+	/* Turn off the LED. */
+	HCLR1(hp, SDHC_HOST_CTL, SDHC_LED_ON);
+
+	DPRINTF(1,("%s: cmd %u done (flags=%#x error=%d)\n",
+	    DEVNAME(hp->sc), cmd->c_opcode, cmd->c_flags, cmd->c_error));
+	SET(cmd->c_flags, SCF_ITSDONE);
+}
+
+/*
+ * Issue a chain of commands without data, like CMD55 + ACMD41, through
+ * the controller's command queue.  The commands go out back to back and
+ * command complete is only signalled after the last one, so only its
+ * response is read back.  On error the controller drops the rest of the
+ * chain and every command is marked failed.
+ */
+void
+sdhc_exec_command_chain(struct sdhc_host *hp, struct sdmmc_command *cmds,
+    int ncmds)
+{
+	DFUNC(sdhc_exec_command_chain);
+
+	struct sdmmc_command *last = &cmds[ncmds - 1];
+	int error = 0;
+	int timeout;
+	int i;
+
+	for (i = 0; i < ncmds; i++)
+		if (cmds[i].c_data != NULL)
+			error = EINVAL;
+
+	if (error == 0)
+		error = sdhc_wait_state(hp, SDHC_CMD_INHIBIT_MASK, 0);
+
+	hp->intr_status = 0;
+	hp->intr_error_status = 0;
+	for (i = 0; error == 0 && i < ncmds; i++) {
+		DPRINTF(1,("%s: queue cmd %u arg=%#x flags=%#x\n",
+		    DEVNAME(hp->sc), cmds[i].c_opcode, cmds[i].c_arg,
+		    cmds[i].c_flags));
+
+		/* Wait for a free slot in the command queue. */
+		for (timeout = 10; timeout > 0; timeout--) {
+			if (HREAD1(hp, SDHC_CMD_QUEUE_STATUS) &
+			    SDHC_CMD_QUEUE_FREE_MASK)
+				break;
+			sdmmc_delay(10000);
+		}
+		if (timeout == 0) {
+			error = ETIMEDOUT;
+			break;
+		}
+
+		HWRITE4(hp, SDHC_ARGUMENT, cmds[i].c_arg);
+		HWRITE2(hp, SDHC_COMMAND, sdhc_command_word(&cmds[i]));
+	}
+
+	if (error == 0 && !sdhc_wait_intr(hp, SDHC_COMMAND_COMPLETE,
+	    SDHC_COMMAND_TIMEOUT))
+		error = ETIMEDOUT;
+
+	for (i = 0; i < ncmds; i++) {
+		cmds[i].c_error = error;
+		SET(cmds[i].c_flags, SCF_ITSDONE);
+	}
+
+	if (error == 0)
+		sdhc_read_response(hp, last);
+}
+
+/*
+ * The host controller removes bits [0:7] from the response
+ * data (CRC) and we pass the data up unchanged to the bus
+ * driver (without padding).
+ */
+void
+sdhc_read_response(struct sdhc_host *hp, struct sdmmc_command *cmd)
+{
+	if (ISSET(cmd->c_flags, SCF_RSP_PRESENT)) {
 		if (ISSET(cmd->c_flags, SCF_RSP_136)) {
 			u_char *p = (u_char *)cmd->c_resp;
 			int i;
@@ -518,13 +832,57 @@ sdhc_exec_command(struct sdhc_host* hp, struct sdmmc_command *cmd)
 		} else
 			cmd->c_resp[0] = HREAD4(hp, SDHC_RESPONSE);
 	}
+}
 
-	/*
-	 * If the command has data to transfer in any direction,
-	 * execute the transfer now.
-	 */
-	if (cmd->c_error == 0 && cmd->c_data != NULL)
-		sdhc_transfer_data(hp, cmd);
+/*
+ * Start `cmd' without waiting for it to finish.  `done' is called from
+ * sdhc_intr() once the command and its data transfer are complete, so
+ * the caller has to route the controller interrupt to sdhc_intr().
+ */
+int
+sdhc_submit_command(struct sdhc_host *hp, struct sdmmc_command *cmd,
+    sdhc_done_t done, void *arg)
+{
+	DFUNC(sdhc_submit_command);
+
+	int error;
+
+	if (hp->intr_cmd != NULL)
+		return EBUSY;
+
+	/* Set up before starting, the interrupt may arrive immediately. */
+	hp->intr_cmd = cmd;
+	hp->intr_done = done;
+	hp->intr_arg = arg;
+	hp->intr_datap = cmd->c_data;
+	hp->intr_datalen = cmd->c_datalen;
+	hp->intr_suspend = SDHC_SUSPEND_NONE;
+	cmd->c_resid = 0;
+	CLR(cmd->c_flags, SCF_SUSPENDED);
+
+	error = sdhc_start_command(hp, cmd);
+	if (error != 0)
+		hp->intr_cmd = NULL;
+	return error;
+}
+
+static void
+sdhc_intr_done(struct sdhc_host *hp, int error)
+{
+	struct sdmmc_command *cmd = hp->intr_cmd;
+
+	hp->intr_cmd = NULL;
+
+	if (hp->intr_suspend != SDHC_SUSPEND_NONE) {
+		hp->intr_suspend = SDHC_SUSPEND_NONE;
+		HCLR1(hp, SDHC_BLOCK_GAP_CTL, SDHC_STOP_AT_BLOCK_GAP);
+	}
+
+	if (error != 0) {
+		cmd->c_error = error;
+		/* Abort whatever is left of the command. */
+		(void)sdhc_soft_reset(hp, SDHC_RESET_CMD | SDHC_RESET_DAT);
+	}
 
 	/* Turn off the LED. */
 	HCLR1(hp, SDHC_HOST_CTL, SDHC_LED_ON);
@@ -532,6 +890,361 @@ sdhc_exec_command(struct sdhc_host* hp, struct sdmmc_command *cmd)
 	DPRINTF(1,("%s: cmd %u done (flags=%#x error=%d)\n",
 	    DEVNAME(hp->sc), cmd->c_opcode, cmd->c_flags, cmd->c_error));
 	SET(cmd->c_flags, SCF_ITSDONE);
+
+	if (hp->intr_done != NULL)
+		hp->intr_done(hp, cmd, hp->intr_arg);
+}
+
+/*
+ * Interrupt handler, drives the command submitted with
+ * sdhc_submit_command().  Returns 1 if the controller had an
+ * interrupt pending.
+ */
+int
+sdhc_intr(struct sdhc_host *hp)
+{
+	DFUNC(sdhc_intr);
+
+	struct sdmmc_command *cmd = hp->intr_cmd;
+	uint16_t status, error;
+	int mask, i;
+
+	status = HREAD2(hp, SDHC_NINTR_STATUS);
+	if (!ISSET(status, SDHC_NINTR_STATUS_MASK))
+		return 0;
+	HWRITE2(hp, SDHC_NINTR_STATUS, status);
+
+	/* Nothing submitted, leave the status to sdhc_wait_intr(). */
+	if (cmd == NULL) {
+		if (ISSET(status, SDHC_ERROR_INTERRUPT)) {
+			error = HREAD2(hp, SDHC_EINTR_STATUS);
+			HWRITE2(hp, SDHC_EINTR_STATUS, error);
+			hp->intr_error_status |= error;
+		}
+		hp->intr_status |= status;
+		return 1;
+	}
+
+	if (ISSET(status, SDHC_ERROR_INTERRUPT)) {
+		error = HREAD2(hp, SDHC_EINTR_STATUS);
+		HWRITE2(hp, SDHC_EINTR_STATUS, error);
+		DPRINTF(0, ("sdhc_intr error: %x\n", error));
+
+		sdhc_intr_done(hp, ISSET(error, SDHC_CMD_TIMEOUT_ERROR |
+		    SDHC_DATA_TIMEOUT_ERROR) ? ETIMEDOUT : EIO);
+		return 1;
+	}
+
+	/* The response of the suspend CMD12 is of no interest. */
+	if (ISSET(status, SDHC_COMMAND_COMPLETE) &&
+	    hp->intr_suspend != SDHC_SUSPEND_STOPPING) {
+		sdhc_read_response(hp, cmd);
+		if (cmd->c_data == NULL) {
+			sdhc_intr_done(hp, 0);
+			return 1;
+		}
+	}
+
+	/*
+	 * PIO, move every block that is ready.  A write only reaches the
+	 * block gap once no more blocks are written.
+	 */
+	if (ISSET(status, SDHC_BUFFER_READ_READY) ||
+	    (ISSET(status, SDHC_BUFFER_WRITE_READY) &&
+	    hp->intr_suspend == SDHC_SUSPEND_NONE)) {
+		mask = ISSET(cmd->c_flags, SCF_CMD_READ) ?
+		    SDHC_BUFFER_READ_ENABLE : SDHC_BUFFER_WRITE_ENABLE;
+		while (hp->intr_datalen > 0 &&
+		    ISSET(HREAD4(hp, SDHC_PRESENT_STATE), mask)) {
+			i = sdhc_pio_len(hp, cmd, (hp->intr_datap -
+			    (u_char *)cmd->c_data) % cmd->c_blklen,
+			    hp->intr_datalen);
+			if (ISSET(cmd->c_flags, SCF_CMD_READ))
+				sdhc_read_data(hp, hp->intr_datap, i);
+			else
+				sdhc_write_data(hp, hp->intr_datap, i);
+			hp->intr_datap += i;
+			hp->intr_datalen -= i;
+		}
+	}
+
+	/* The buffer is contiguous, continue where SDMA stopped. */
+	if (ISSET(status, SDHC_DMA_INTERRUPT) &&
+	    !ISSET(hp->flags, SDHC_F_ADMA2))
+		HWRITE4(hp, SDHC_DMA_ADDR, HREAD4(hp, SDHC_DMA_ADDR));
+
+	/* Stopped at the block gap, let the card go with a suspend CMD12. */
+	if (ISSET(status, SDHC_BLOCK_GAP_EVENT) &&
+	    hp->intr_suspend == SDHC_SUSPEND_AT_GAP) {
+		hp->intr_suspend = SDHC_SUSPEND_STOPPING;
+		HWRITE4(hp, SDHC_ARGUMENT, 0);
+		HWRITE2(hp, SDHC_COMMAND,
+		    (MMC_STOP_TRANSMISSION << SDHC_COMMAND_INDEX_SHIFT) |
+		    SDHC_COMMAND_TYPE_SUSPEND | SDHC_CRC_CHECK_ENABLE |
+		    SDHC_INDEX_CHECK_ENABLE | SDHC_RESP_LEN_48_CHK_BUSY);
+	}
+
+	if (ISSET(status, SDHC_TRANSFER_COMPLETE)) {
+		/* The block count is left at what the card did not see. */
+		if (hp->intr_suspend == SDHC_SUSPEND_STOPPING) {
+			cmd->c_resid = HREAD2(hp, SDHC_BLOCK_COUNT) *
+			    cmd->c_blklen;
+			if (cmd->c_resid > 0)
+				SET(cmd->c_flags, SCF_SUSPENDED);
+		}
+		sdhc_intr_done(hp, 0);
+	}
+
+	return 1;
+}
+
+/*
+ * Suspend the transfer submitted with sdhc_submit_command() at the next
+ * block gap, e.g. to get a more urgent command through.  Memory cards
+ * can not resume a transfer, the controller ends it with a CMD12 of type
+ * suspend instead.  `done' then sees SCF_SUSPENDED and c_resid covering
+ * the blocks the card did not get, the caller resumes by submitting a
+ * command for those.  A transfer that ends before a gap completes as
+ * usual.  Only PIO and SDMA transfers can be suspended.
+ */
+int
+sdhc_suspend_command(struct sdhc_host *hp)
+{
+	DFUNC(sdhc_suspend_command);
+
+	struct sdmmc_command *cmd = hp->intr_cmd;
+
+	if (cmd == NULL || cmd->c_data == NULL)
+		return EINVAL;
+	if (ISSET(hp->transfer_mode, SDHC_DMA_ENABLE) &&
+	    ISSET(hp->flags, SDHC_F_ADMA2))
+		return EINVAL;
+	if (hp->intr_suspend != SDHC_SUSPEND_NONE)
+		return EBUSY;
+
+	hp->intr_suspend = SDHC_SUSPEND_AT_GAP;
+	HSET1(hp, SDHC_BLOCK_GAP_CTL, SDHC_STOP_AT_BLOCK_GAP);
+	return 0;
+}
+
+/*
+ * Open ended multi block transfers for streaming.  sdhc_stream_start()
+ * issues `cmd' without a block count, c_data only has to hold the first
+ * block.  The blocks are then handed over with sdhc_stream_write() for
+ * as long as the caller likes and sdhc_stream_stop() ends the transfer
+ * once they went out.  PIO writes only, polled like sdhc_exec_command().
+ */
+int
+sdhc_stream_start(struct sdhc_host *hp, struct sdmmc_command *cmd)
+{
+	DFUNC(sdhc_stream_start);
+
+	int error;
+
+	if (ISSET(cmd->c_flags, SCF_CMD_READ) || cmd->c_data == NULL)
+		return EINVAL;
+
+	SET(cmd->c_flags, SCF_OPEN_ENDED);
+	error = sdhc_start_command(hp, cmd);
+	if (error == 0 && !sdhc_wait_intr(hp, SDHC_COMMAND_COMPLETE,
+	    SDHC_COMMAND_TIMEOUT)) {
+		error = ETIMEDOUT;
+		(void)sdhc_soft_reset(hp, SDHC_RESET_CMD | SDHC_RESET_DAT);
+		HCLR1(hp, SDHC_HOST_CTL, SDHC_LED_ON);
+	}
+	if (error == 0)
+		sdhc_read_response(hp, cmd);
+
+	cmd->c_error = error;
+	return error;
+}
+
+/*
+ * Hand the next block of an open ended transfer to the controller.
+ * Returns EBUSY while its buffer has no room for it.
+ */
+int
+sdhc_stream_write(struct sdhc_host *hp, u_char *datap, int datalen)
+{
+	uint16_t status, error;
+
+	status = HREAD2(hp, SDHC_NINTR_STATUS);
+	if (ISSET(status, SDHC_ERROR_INTERRUPT)) {
+		error = HREAD2(hp, SDHC_EINTR_STATUS);
+		HWRITE2(hp, SDHC_EINTR_STATUS, error);
+		HWRITE2(hp, SDHC_NINTR_STATUS, status);
+		DPRINTF(0, ("sdhc_stream_write error: %x\n", error));
+
+		(void)sdhc_soft_reset(hp, SDHC_RESET_CMD | SDHC_RESET_DAT);
+		HCLR1(hp, SDHC_HOST_CTL, SDHC_LED_ON);
+		return ISSET(error, SDHC_DATA_TIMEOUT_ERROR) ? ETIMEDOUT : EIO;
+	}
+
+	if (!ISSET(HREAD4(hp, SDHC_PRESENT_STATE), SDHC_BUFFER_WRITE_ENABLE))
+		return EBUSY;
+
+	sdhc_write_data(hp, datap, datalen);
+	return 0;
+}
+
+/*
+ * Stop an open ended transfer once the blocks handed over went out, at
+ * the block gap that follows, and end it with an abort CMD12.
+ */
+int
+sdhc_stream_stop(struct sdhc_host *hp)
+{
+	DFUNC(sdhc_stream_stop);
+
+	int error = 0;
+
+	HSET1(hp, SDHC_BLOCK_GAP_CTL, SDHC_STOP_AT_BLOCK_GAP);
+	if (!ISSET(sdhc_wait_intr(hp, SDHC_BLOCK_GAP_EVENT,
+	    SDHC_TRANSFER_TIMEOUT), SDHC_BLOCK_GAP_EVENT))
+		error = ETIMEDOUT;
+
+	if (error == 0) {
+		HWRITE4(hp, SDHC_ARGUMENT, 0);
+		HWRITE2(hp, SDHC_COMMAND,
+		    (MMC_STOP_TRANSMISSION << SDHC_COMMAND_INDEX_SHIFT) |
+		    SDHC_COMMAND_TYPE_ABORT | SDHC_CRC_CHECK_ENABLE |
+		    SDHC_INDEX_CHECK_ENABLE | SDHC_RESP_LEN_48_CHK_BUSY);
+		if (!ISSET(sdhc_wait_intr(hp, SDHC_TRANSFER_COMPLETE,
+		    SDHC_TRANSFER_TIMEOUT), SDHC_TRANSFER_COMPLETE))
+			error = ETIMEDOUT;
+	}
+
+	HCLR1(hp, SDHC_BLOCK_GAP_CTL, SDHC_STOP_AT_BLOCK_GAP);
+	if (error != 0)
+		(void)sdhc_soft_reset(hp, SDHC_RESET_CMD | SDHC_RESET_DAT);
+
+	/* Turn off the LED. */
+	HCLR1(hp, SDHC_HOST_CTL, SDHC_LED_ON);
+	return error;
+}
+
+/*
+ * Hold back the interrupts of a running data transfer until `events'
+ * buffer ready, DMA or command complete interrupts were seen, or
+ * `cycles' controller clock cycles after the first of them.  Transfer
+ * complete and errors are always signalled right away, so a transfer
+ * usually takes a single sdhc_intr().  For PIO `events' must not exceed
+ * the number of blocks the controller buffers.  0 events turns it off.
+ */
+int
+sdhc_intr_coalescing(struct sdhc_host *hp, int events, int cycles)
+{
+	DFUNC(sdhc_intr_coalescing);
+
+	if (!ISSET(hp->flags, SDHC_F_VENDOR_REGS))
+		return ENODEV;
+	if (events < 0 || events > SDHC_INTR_COALESCING_EVENTS_MASK ||
+	    cycles < 0 || cycles > SDHC_INTR_COALESCING_TIMEOUT_MASK)
+		return EINVAL;
+
+	HWRITE4(hp, SDHC_INTR_COALESCING,
+	    (events << SDHC_INTR_COALESCING_EVENTS_SHIFT) |
+	    (cycles << SDHC_INTR_COALESCING_TIMEOUT_SHIFT));
+	return 0;
+}
+
+/*
+ * Start sending a write block once `words' 32-bit words of it are in
+ * the buffer instead of waiting for all of it.  The data has to keep
+ * ahead of the card for the rest of the block, which a polled PIO write
+ * or SDMA usually manages.  The card rejects a block that ran dry with
+ * a CRC error.  0 words waits for whole blocks again.
+ */
+int
+sdhc_write_cut_through(struct sdhc_host *hp, int words)
+{
+	DFUNC(sdhc_write_cut_through);
+
+	if (!ISSET(hp->flags, SDHC_F_VENDOR_REGS))
+		return ENODEV;
+	if (words < 0 || words > SDHC_CUT_THROUGH_MASK)
+		return EINVAL;
+
+	hp->bufctl &= ~(SDHC_CUT_THROUGH_MASK << SDHC_CUT_THROUGH_SHIFT);
+	hp->bufctl |= words << SDHC_CUT_THROUGH_SHIFT;
+	HWRITE4(hp, SDHC_BUFFER_CTL, hp->bufctl);
+	return 0;
+}
+
+/*
+ * Signal the buffer ready once `rwords' 32-bit words can be read or
+ * `wwords' written instead of whole blocks, PIO then moves each block
+ * in parts of that size while the rest is still on the bus.  The parts
+ * have to keep the buffer data window aligned.  0 keeps whole blocks.
+ */
+int
+sdhc_buffer_watermarks(struct sdhc_host *hp, int rwords, int wwords)
+{
+	DFUNC(sdhc_buffer_watermarks);
+
+	if (!ISSET(hp->flags, SDHC_F_VENDOR_REGS))
+		return ENODEV;
+	if (rwords < 0 || rwords > SDHC_WATERMARK_MASK ||
+	    wwords < 0 || wwords > SDHC_WATERMARK_MASK)
+		return EINVAL;
+	if (hp->winwidth > 4 &&
+	    ((rwords * 4) % hp->winwidth || (wwords * 4) % hp->winwidth))
+		return EINVAL;
+
+	hp->bufctl &= ~((SDHC_WATERMARK_MASK << SDHC_READ_WATERMARK_SHIFT) |
+	    (SDHC_WATERMARK_MASK << SDHC_WRITE_WATERMARK_SHIFT));
+	hp->bufctl |= (rwords << SDHC_READ_WATERMARK_SHIFT) |
+	    (wwords << SDHC_WRITE_WATERMARK_SHIFT);
+	HWRITE4(hp, SDHC_BUFFER_CTL, hp->bufctl);
+	return 0;
+}
+
+/*
+ * Bytes PIO may move once the buffer is ready, `off' bytes into the
+ * current block.  Without a watermark that is the rest of the block.
+ */
+static int
+sdhc_pio_len(struct sdhc_host *hp, struct sdmmc_command *cmd, int off,
+    int datalen)
+{
+	int words;
+
+	words = (hp->bufctl >> (ISSET(cmd->c_flags, SCF_CMD_READ) ?
+	    SDHC_READ_WATERMARK_SHIFT : SDHC_WRITE_WATERMARK_SHIFT)) &
+	    SDHC_WATERMARK_MASK;
+	if (words == 0 || ISSET(hp->transfer_mode, SDHC_DMA_ENABLE))
+		return MIN(datalen, cmd->c_blklen - off);
+	return MIN(MIN(datalen, cmd->c_blklen - off), words * 4);
+}
+
+/*
+ * Prepare command register value. (2.2.6)
+ */
+static u_int16_t
+sdhc_command_word(struct sdmmc_command *cmd)
+{
+	u_int16_t command;
+
+	command = (cmd->c_opcode & SDHC_COMMAND_INDEX_MASK) <<
+	    SDHC_COMMAND_INDEX_SHIFT;
+
+	if (ISSET(cmd->c_flags, SCF_RSP_CRC))
+		command |= SDHC_CRC_CHECK_ENABLE;
+	if (ISSET(cmd->c_flags, SCF_RSP_IDX))
+		command |= SDHC_INDEX_CHECK_ENABLE;
+	if (cmd->c_data != NULL)
+		command |= SDHC_DATA_PRESENT_SELECT;
+
+	if (!ISSET(cmd->c_flags, SCF_RSP_PRESENT))
+		command |= SDHC_NO_RESPONSE;
+	else if (ISSET(cmd->c_flags, SCF_RSP_136))
+		command |= SDHC_RESP_LEN_136;
+	else if (ISSET(cmd->c_flags, SCF_RSP_BSY))
+		command |= SDHC_RESP_LEN_48_CHK_BUSY;
+	else
+		command |= SDHC_RESP_LEN_48;
+
+	return command;
 }
 
 int
@@ -539,10 +1252,12 @@ sdhc_start_command(struct sdhc_host *hp, struct sdmmc_command *cmd)
 {
 	DFUNC(sdhc_start_command);
 
-	// struct sdhc_adma2_descriptor32 *desc32 = (void *)hp->adma2;
-	// struct sdhc_adma2_descriptor64 *desc64 = (void *)hp->adma2;
+	struct sdhc_adma2_descriptor32 *desc32 = (void *)hp->adma2;
+	struct sdhc_adma2_descriptor64 *desc64 = (void *)hp->adma2;
+	struct sdmmc_dma_segment single, *segs;
+	int nsegs, ndesc;
 	u_int16_t blksize = 0;
-	u_int16_t blkcount = 0;
+	int blkcount = 0;
 	u_int16_t mode;
 	u_int16_t command;
 	int error;
@@ -563,14 +1278,14 @@ sdhc_start_command(struct sdhc_host *hp, struct sdmmc_command *cmd)
 		blksize = MIN(cmd->c_datalen, cmd->c_blklen);
 		blkcount = cmd->c_datalen / blksize;
 		if (cmd->c_datalen % blksize > 0) {
-			/* XXX: Split this command. (1.7.4) */
+			/* sdhc_exec_command() splits what it can. (1.7.4) */
 			DPRINTF(0, ("%s: data not a multiple of %d bytes\n",
 			    DEVNAME(hp->sc), blksize));
 			return EINVAL;
 		}
 	}
 
-	/* Check limit imposed by 9-bit block count. (1.7.2) */
+	/* Check limit imposed by the 16-bit block count. (1.7.2) */
 	if (blkcount > SDHC_BLOCK_COUNT_MAX) {
 		DPRINTF(0, ("%s: too much data\n", DEVNAME(hp->sc)));
 		return EINVAL;
@@ -580,36 +1295,63 @@ sdhc_start_command(struct sdhc_host *hp, struct sdmmc_command *cmd)
 	mode = 0;
 	if (ISSET(cmd->c_flags, SCF_CMD_READ))
 		mode |= SDHC_READ_MODE;
+	if (cmd->c_dmamap != NULL) {
+		/* A scatter list can only be handled by ADMA2. */
+		if (!ISSET(hp->flags, SDHC_F_ADMA2))
+			return EINVAL;
+		segs = cmd->c_dmamap->dm_segs;
+		nsegs = cmd->c_dmamap->dm_nsegs;
+	} else {
+		single.ds_addr = cmd->c_data;
+		single.ds_len = cmd->c_datalen;
+		segs = &single;
+		nsegs = 1;
+	}
+	if (cmd->c_data != NULL &&
+	    ISSET(hp->flags, SDHC_F_SDMA | SDHC_F_ADMA2)) {
+		mode |= SDHC_DMA_ENABLE;
+		for (seg = 0; seg < nsegs; seg++) {
+			if (!SDHC_DMA_ALIGNED(segs[seg].ds_addr,
+			    segs[seg].ds_len))
+				CLR(mode, SDHC_DMA_ENABLE);
+			/* Fall back to PIO above 4 GiB. */
+			if (!ISSET(hp->flags, SDHC_F_ADMA64) &&
+			    !SDHC_DMA_32BIT(segs[seg].ds_addr,
+			    segs[seg].ds_len))
+				CLR(mode, SDHC_DMA_ENABLE);
+		}
+		/* So does the descriptor table itself. */
+		if (ISSET(hp->flags, SDHC_F_ADMA2) &&
+		    !ISSET(hp->flags, SDHC_F_ADMA64) &&
+		    !SDHC_DMA_32BIT(hp->adma2, sizeof(hp->adma2)))
+			CLR(mode, SDHC_DMA_ENABLE);
+		if (cmd->c_dmamap != NULL && !ISSET(mode, SDHC_DMA_ENABLE))
+			return EINVAL;
+	}
 	if (blkcount > 0) {
 		mode |= SDHC_BLOCK_COUNT_ENABLE;
-		if (blkcount > 1) {
+		/* A split may leave a multiple block command with one block. */
+		if (blkcount > 1 || cmd->c_opcode == MMC_READ_BLOCK_MULTIPLE ||
+		    cmd->c_opcode == MMC_WRITE_BLOCK_MULTIPLE) {
 			mode |= SDHC_MULTI_BLOCK_MODE;
-			if (cmd->c_opcode != SD_IO_RW_EXTENDED)
+			/* Argument 2 shares its register with the SDMA address. */
+			if (ISSET(cmd->c_flags, SCF_AUTO_CMD23) &&
+			    ISSET(hp->flags, SDHC_F_AUTO_CMD23) &&
+			    (!ISSET(mode, SDHC_DMA_ENABLE) ||
+			    ISSET(hp->flags, SDHC_F_ADMA2)))
+				mode |= SDHC_AUTO_CMD23_ENABLE;
+			else if (cmd->c_opcode != SD_IO_RW_EXTENDED)
 				mode |= SDHC_AUTO_CMD12_ENABLE;
 		}
 	}
+	/* See sdhc_stream_start(), the caller moves the data and stops. */
+	if (ISSET(cmd->c_flags, SCF_OPEN_ENDED))
+		mode = (mode & SDHC_READ_MODE) | SDHC_MULTI_BLOCK_MODE;
+	/* Let the caller know whether CMD23 actually went out. */
+	if (!ISSET(mode, SDHC_AUTO_CMD23_ENABLE))
+		CLR(cmd->c_flags, SCF_AUTO_CMD23);
 
-	/*
-	 * Prepare command register value. (2.2.6)
-	 */
-	command = (cmd->c_opcode & SDHC_COMMAND_INDEX_MASK) <<
-	    SDHC_COMMAND_INDEX_SHIFT;
-
-	if (ISSET(cmd->c_flags, SCF_RSP_CRC))
-		command |= SDHC_CRC_CHECK_ENABLE;
-	if (ISSET(cmd->c_flags, SCF_RSP_IDX))
-		command |= SDHC_INDEX_CHECK_ENABLE;
-	if (cmd->c_data != NULL)
-		command |= SDHC_DATA_PRESENT_SELECT;
-
-	if (!ISSET(cmd->c_flags, SCF_RSP_PRESENT))
-		command |= SDHC_NO_RESPONSE;
-	else if (ISSET(cmd->c_flags, SCF_RSP_136))
-		command |= SDHC_RESP_LEN_136;
-	else if (ISSET(cmd->c_flags, SCF_RSP_BSY))
-		command |= SDHC_RESP_LEN_48_CHK_BUSY;
-	else
-		command |= SDHC_RESP_LEN_48;
+	command = sdhc_command_word(cmd);
 
 	/* Wait until command and data inhibit bits are clear. (1.5) */
 	if ((error = sdhc_wait_state(hp, SDHC_CMD_INHIBIT_MASK, 0)) != 0)
@@ -620,58 +1362,68 @@ sdhc_start_command(struct sdhc_host *hp, struct sdmmc_command *cmd)
 	/* Alert the user not to remove the card. */
 	HSET1(hp, SDHC_HOST_CTL, SDHC_LED_ON);
 
-	/* Set DMA start address if SHF_USE_DMA is set. */
-	// if (cmd->c_dmamap && ISSET(hp->flags, SHF_USE_DMA)) {
-	// 	for (seg = 0; seg < cmd->c_dmamap->dm_nsegs; seg++) {
-	// 		bus_addr_t paddr =
-	// 		    cmd->c_dmamap->dm_segs[seg].ds_addr;
-	// 		uint16_t len =
-	// 		    cmd->c_dmamap->dm_segs[seg].ds_len == 65536 ?
-	// 		    0 : cmd->c_dmamap->dm_segs[seg].ds_len;
-	// 		uint16_t attr;
-
-	// 		attr = SDHC_ADMA2_VALID | SDHC_ADMA2_ACT_TRANS;
-	// 		if (seg == cmd->c_dmamap->dm_nsegs - 1)
-	// 			attr |= SDHC_ADMA2_END;
-
-	// 		if (ISSET(hp->flags, SHF_USE_DMA64)) {
-	// 			desc64[seg].attribute = htole16(attr);
-	// 			desc64[seg].length = htole16(len);
-	// 			desc64[seg].address_lo =
-	// 			    htole32((uint64_t)paddr & 0xffffffff);
-	// 			desc64[seg].address_hi =
-	// 			    htole32((uint64_t)paddr >> 32);
-	// 		} else {
-	// 			desc32[seg].attribute = htole16(attr);
-	// 			desc32[seg].length = htole16(len);
-	// 			desc32[seg].address = htole32(paddr);
-	// 		}
-	// 	}
-
-	// 	if (ISSET(hp->flags, SHF_USE_DMA64))
-	// 		desc64[cmd->c_dmamap->dm_nsegs].attribute = htole16(0);
-	// 	else
-	// 		desc32[cmd->c_dmamap->dm_nsegs].attribute = htole16(0);
-
-	// 	bus_dmamap_sync(sc->sc_dmat, hp->adma_map, 0, PAGE_SIZE,
-	// 	    BUS_DMASYNC_PREWRITE);
-
-	// 	HCLR1(hp, SDHC_HOST_CTL, SDHC_DMA_SELECT);
-	// 	if (ISSET(hp->flags, SHF_USE_DMA64))
-	// 		HSET1(hp, SDHC_HOST_CTL, SDHC_DMA_SELECT_ADMA64);
-	// 	else
-	// 		HSET1(hp, SDHC_HOST_CTL, SDHC_DMA_SELECT_ADMA32);
-
-	// 	HWRITE4(hp, SDHC_ADMA_SYSTEM_ADDR,
-	// 	    hp->adma_map->dm_segs[0].ds_addr);
-	// } else
-	HCLR1(hp, SDHC_HOST_CTL, SDHC_DMA_SELECT);
+	/* Build the ADMA2 descriptor table if SDHC_F_ADMA2 is set. */
+	if (ISSET(mode, SDHC_DMA_ENABLE) && ISSET(hp->flags, SDHC_F_ADMA2)) {
+		ndesc = 0;
+		for (seg = 0; seg < nsegs; seg++) {
+			uint64_t paddr = (uintptr_t)segs[seg].ds_addr;
+			size_t resid = segs[seg].ds_len;
+
+			while (resid > 0) {
+				size_t len = MIN(resid, SDHC_ADMA2_MAX_LEN);
+				uint16_t attr;
+
+				if (ndesc == SDHC_ADMA2_NDESC)
+					return EINVAL;
+
+				resid -= len;
+				attr = SDHC_ADMA2_VALID | SDHC_ADMA2_ACT_TRANS;
+				if (seg == nsegs - 1 && resid == 0)
+					attr |= SDHC_ADMA2_END;
+
+				if (ISSET(hp->flags, SDHC_F_ADMA64)) {
+					desc64[ndesc].attribute = attr;
+					desc64[ndesc].length = len & 0xffff;
+					desc64[ndesc].address_lo = paddr;
+					desc64[ndesc].address_hi = paddr >> 32;
+				} else {
+					desc32[ndesc].attribute = attr;
+					desc32[ndesc].length = len & 0xffff;
+					desc32[ndesc].address = paddr;
+				}
+				paddr += len;
+				ndesc++;
+			}
+		}
+
+		HCLR1(hp, SDHC_HOST_CTL, SDHC_DMA_SELECT);
+		if (ISSET(hp->flags, SDHC_F_ADMA64)) {
+			HSET1(hp, SDHC_HOST_CTL, SDHC_DMA_SELECT_ADMA64);
+			HWRITE4(hp, SDHC_ADMA_SYSTEM_ADDR_HI,
+			    (uint64_t)(uintptr_t)hp->adma2 >> 32);
+		} else
+			HSET1(hp, SDHC_HOST_CTL, SDHC_DMA_SELECT_ADMA32);
+
+		HWRITE4(hp, SDHC_ADMA_SYSTEM_ADDR,
+		    (uint32_t)(uintptr_t)hp->adma2);
+	} else if (ISSET(mode, SDHC_DMA_ENABLE)) {
+		/*
+		 * SDMA moves the data straight into the command buffer,
+		 * only stopping at 512K boundaries.
+		 */
+		HCLR1(hp, SDHC_HOST_CTL, SDHC_DMA_SELECT);
+		HWRITE4(hp, SDHC_DMA_ADDR, (uint32_t)(uintptr_t)cmd->c_data);
+		blksize |= SDHC_SDMA_BOUNDARY_512K;
+	} else
+		HCLR1(hp, SDHC_HOST_CTL, SDHC_DMA_SELECT);
 
 	DPRINTF(1,("%s: cmd=%#x mode=%#x blksize=%d blkcount=%d\n",
 	    DEVNAME(hp->sc), command, mode, blksize, blkcount));
 
 	/* We're starting a new command, reset state. */
 	hp->intr_status = 0;
+	hp->intr_error_status = 0;
+	hp->transfer_mode = mode;
 
 	/*
 	 * Start a CPU data transfer.  Writing to the high order byte
@@ -680,6 +1432,27 @@ sdhc_start_command(struct sdhc_host *hp, struct sdmmc_command *cmd)
 	HWRITE2(hp, SDHC_TRANSFER_MODE, mode);
 	HWRITE2(hp, SDHC_BLOCK_SIZE, blksize);
 	HWRITE2(hp, SDHC_BLOCK_COUNT, blkcount);
+
+	/*
+	 * Write the blocks that fit into the buffer ahead of the command,
+	 * the first one then goes out right after the response.  Submitted
+	 * commands are left to sdhc_intr(), it may run at any time.
+	 */
+	hp->prefilled = 0;
+	if (ISSET(hp->flags, SDHC_F_PREFILL) && blkcount > 0 &&
+	    !ISSET(mode, SDHC_READ_MODE | SDHC_DMA_ENABLE) &&
+	    !ISSET(cmd->c_flags, SCF_OPEN_ENDED) && hp->intr_cmd != cmd) {
+		while (hp->prefilled < cmd->c_datalen &&
+		    ISSET(HREAD4(hp, SDHC_PRESENT_STATE),
+		    SDHC_BUFFER_WRITE_ENABLE)) {
+			sdhc_write_data(hp,
+			    (u_char *)cmd->c_data + hp->prefilled, blksize);
+			hp->prefilled += blksize;
+		}
+	}
+
+	if (ISSET(mode, SDHC_AUTO_CMD23_ENABLE))
+		HWRITE4(hp, SDHC_ARGUMENT2, blkcount);
 	HWRITE4(hp, SDHC_ARGUMENT, cmd->c_arg);
 	HWRITE2(hp, SDHC_COMMAND, command);
 
@@ -700,7 +1473,9 @@ sdhc_transfer_data(struct sdhc_host *hp, struct sdmmc_command *cmd)
 	mask = ISSET(cmd->c_flags, SCF_CMD_READ) ?
 	    SDHC_BUFFER_READ_ENABLE : SDHC_BUFFER_WRITE_ENABLE;
 	error = 0;
-	datalen = cmd->c_datalen;
+	/* sdhc_start_command() may have written the first blocks. */
+	datap += hp->prefilled;
+	datalen = cmd->c_datalen - hp->prefilled;
 
 	DPRINTF(1,("%s: resp=%#x datalen=%d\n", DEVNAME(hp->sc),
 	    MMC_R1(cmd->c_resp), datalen));
@@ -713,8 +1488,15 @@ sdhc_transfer_data(struct sdhc_host *hp, struct sdmmc_command *cmd)
 		    DEVNAME(hp->sc), MMC_R1(cmd->c_resp) & 0xff00);
 #endif
 
+	if (ISSET(hp->transfer_mode, SDHC_DMA_ENABLE)) {
+		error = sdhc_transfer_dma(hp);
+		goto done;
+	}
+
 	while (datalen > 0) {
-		if (!sdhc_wait_intr(hp, SDHC_BUFFER_READ_READY|
+		/* With watermarks the buffer may still be ready. */
+		if (!ISSET(HREAD4(hp, SDHC_PRESENT_STATE), mask) &&
+		    !sdhc_wait_intr(hp, SDHC_BUFFER_READ_READY|
 		    SDHC_BUFFER_WRITE_READY, SDHC_BUFFER_TIMEOUT)) {
 			error = ETIMEDOUT;
 			break;
@@ -723,7 +1505,8 @@ sdhc_transfer_data(struct sdhc_host *hp, struct sdmmc_command *cmd)
 		if ((error = sdhc_wait_state(hp, mask, mask)) != 0)
 			break;
 
-		i = MIN(datalen, cmd->c_blklen);
+		i = sdhc_pio_len(hp, cmd,
+		    (datap - (u_char *)cmd->c_data) % cmd->c_blklen, datalen);
 		if (ISSET(cmd->c_flags, SCF_CMD_READ))
 			sdhc_read_data(hp, datap, i);
 		else
@@ -746,11 +1529,63 @@ done:
 	    DEVNAME(hp->sc), cmd->c_error));
 }
 
+/*
+ * Wait for an SDMA or ADMA2 transfer to finish, restarting the SDMA
+ * engine whenever it stops at a buffer boundary.
+ */
+int
+sdhc_transfer_dma(struct sdhc_host *hp)
+{
+	DFUNC(sdhc_transfer_dma);
+
+	int status;
+
+	for (;;) {
+		status = sdhc_wait_intr(hp, SDHC_TRANSFER_COMPLETE|
+		    SDHC_DMA_INTERRUPT, SDHC_DMA_TIMEOUT);
+		if (!status || ISSET(status, SDHC_ERROR_INTERRUPT)) {
+			DPRINTF(0, ("%s: dma error, adma status %#x\n",
+			    DEVNAME(hp->sc),
+			    HREAD1(hp, SDHC_ADMA_ERROR_STATUS)));
+			/* The engine stopped mid transfer, abort it. */
+			(void)sdhc_soft_reset(hp, SDHC_RESET_DAT);
+			return status ? EIO : ETIMEDOUT;
+		}
+		if (ISSET(status, SDHC_TRANSFER_COMPLETE))
+			return 0;
+
+		/* The buffer is contiguous, continue where SDMA stopped. */
+		if (!ISSET(hp->flags, SDHC_F_ADMA2))
+			HWRITE4(hp, SDHC_DMA_ADDR, HREAD4(hp, SDHC_DMA_ADDR));
+	}
+}
+
+/*
+ * Bytes at the start of datap that can be copied through the buffer data
+ * window, memcpy has to move them in whole longs to or from the window.
+ */
+static int
+sdhc_window_len(struct sdhc_host *hp, u_char *datap, int datalen)
+{
+	if (hp->winwidth == 0 || ((u_long)datap & (sizeof(long) - 1)) != 0)
+		return 0;
+	return MIN(datalen, SDHC_DATA_WINDOW_SIZE) & ~(sizeof(long) - 1);
+}
+
 void
 sdhc_read_data(struct sdhc_host *hp, u_char *datap, int datalen)
 {
 	DFUNC(sdhc_read_data);
 
+	int i;
+
+	i = sdhc_window_len(hp, datap, datalen);
+	if (i > 0) {
+		memcpy(datap, (void *)(uintptr_t)(hp->mmio + SDHC_DATA_WINDOW),
+		    i);
+		datap += i;
+		datalen -= i;
+	}
 	while (datalen > 3) {
 		*(u_int32_t *)datap = HREAD4(hp, SDHC_DATA);
 		datap += 4;
@@ -770,6 +1605,15 @@ sdhc_write_data(struct sdhc_host *hp, u_char *datap, int datalen)
 {
 	DFUNC(sdhc_write_data);
 
+	int i;
+
+	i = sdhc_window_len(hp, datap, datalen);
+	if (i > 0) {
+		memcpy((void *)(uintptr_t)(hp->mmio + SDHC_DATA_WINDOW), datap,
+		    i);
+		datap += i;
+		datalen -= i;
+	}
 	while (datalen > 3) {
 		DPRINTF(3,("%08x\n", *(u_int32_t *)datap));
 		HWRITE4(hp, SDHC_DATA, *((u_int32_t *)datap));
@@ -819,34 +1663,34 @@ sdhc_wait_intr(struct sdhc_host *hp, int mask, int secs)
 {
 	DFUNC(sdhc_wait_intr);
 
+	uint16_t error, sigen;
 	int status, usecs;
 
 	mask |= SDHC_ERROR_INTERRUPT;
 	usecs = secs * 1000000 * 1000;
-	status = hp->intr_status;
-	while ((status & mask) == 0) {
+	/* sdhc_intr() may already have taken the error status for us. */
+	if (ISSET(hp->intr_status, SDHC_ERROR_INTERRUPT))
+		DPRINTF(0, ("sdhc_wait_intr error: %x\n",
+		    hp->intr_error_status));
+	/*
+	 * With nothing submitted sdhc_intr() clears the status itself and
+	 * leaves it in hp->intr_status, look there on every pass.
+	 */
+	status = 0;
+	while (((status |= hp->intr_status) & mask) == 0) {
+		if (hp->intr_poll != NULL)
+			hp->intr_poll(hp);
 
 		status = HREAD2(hp, SDHC_NINTR_STATUS);
 		DPRINTF(1, ("sdhc_wait_intr status: %x, mask: %x\n", status, mask));
 		if (ISSET(status, SDHC_NINTR_STATUS_MASK)) {
 			HWRITE2(hp, SDHC_NINTR_STATUS, status);
 
+			error = 0;
 			if (ISSET(status, SDHC_ERROR_INTERRUPT)) {
-				uint16_t error;
 				error = HREAD2(hp, SDHC_EINTR_STATUS);
 				HWRITE2(hp, SDHC_EINTR_STATUS, error);
-				hp->intr_status |= status;
-
 				DPRINTF(0, ("sdhc_wait_intr error: %x\n", error));
-				if (ISSET(error, SDHC_CMD_TIMEOUT_ERROR|
-				    SDHC_DATA_TIMEOUT_ERROR))
-					break;
-			}
-
-			if (ISSET(status, SDHC_BUFFER_READ_READY |
-			    SDHC_BUFFER_WRITE_READY | SDHC_COMMAND_COMPLETE |
-			    SDHC_TRANSFER_COMPLETE)) {
-				hp->intr_status |= status;
 			}
 
 			if (ISSET(status, SDHC_CARD_INTERRUPT)) {
@@ -854,6 +1698,13 @@ sdhc_wait_intr(struct sdhc_host *hp, int mask, int secs)
 				    SDHC_CARD_INTERRUPT);
 			}
 
+			/* Keep sdhc_intr() out while merging the status. */
+			sigen = HREAD2(hp, SDHC_NINTR_SIGNAL_EN);
+			HWRITE2(hp, SDHC_NINTR_SIGNAL_EN, 0);
+			hp->intr_status |= status;
+			hp->intr_error_status |= error;
+			HWRITE2(hp, SDHC_NINTR_SIGNAL_EN, sigen);
+
 			continue;
 		}
 
@@ -866,7 +1717,12 @@ sdhc_wait_intr(struct sdhc_host *hp, int mask, int secs)
 		}
 	}
 
+	sigen = HREAD2(hp, SDHC_NINTR_SIGNAL_EN);
+	HWRITE2(hp, SDHC_NINTR_SIGNAL_EN, 0);
+	if (ISSET(status, SDHC_ERROR_INTERRUPT))
+		hp->intr_error_status = 0;
 	hp->intr_status &= ~(status & mask);
+	HWRITE2(hp, SDHC_NINTR_SIGNAL_EN, sigen);
 
 	// DPRINTF(("sdhc_wait_intr: %x\n", (status & mask)));
 	return (status & mask);
@@ -57,6 +57,16 @@ sdmmc_init(struct sdmmc_softc *sc, struct sdhc_host *hp, uint8_t* scratch_buffer
 
 	if (ISSET(hp->flags, SDHC_F_NONREMOVABLE))
 		sc->sc_caps |= SMC_CAPS_NONREMOVABLE;
+	if (ISSET(hp->flags, SDHC_F_HIGHSPEED))
+		sc->sc_caps |= SMC_CAPS_SD_HIGHSPEED | SMC_CAPS_MMC_HIGHSPEED;
+	if (ISSET(hp->flags, SDHC_F_8BIT))
+		sc->sc_caps |= SMC_CAPS_8BIT_MODE;
+	if (ISSET(hp->flags, SDHC_F_DDR50))
+		sc->sc_caps |= SMC_CAPS_MMC_DDR52;
+	if (ISSET(hp->flags, SDHC_F_SDR50))
+		sc->sc_caps |= SMC_CAPS_UHS_SDR50;
+	if (ISSET(hp->flags, SDHC_F_SDR104))
+		sc->sc_caps |= SMC_CAPS_UHS_SDR104;
 	
 	SET(sc->sc_flags, SMF_CONFIG_PENDING);
 	sdmmc_discover_cards(sc);
@@ -255,7 +265,7 @@ sdmmc_app_command(struct sdmmc_softc *sc, struct sdmmc_command *cmd)
 {
 	DFUNC(sdmmc_app_command);
 
-	struct sdmmc_command acmd;
+	struct sdmmc_command acmd, chain[2];
 	int error;
 
 	// rw_assert_wrlock(&sc->sc_lock);
@@ -265,6 +275,28 @@ sdmmc_app_command(struct sdmmc_softc *sc, struct sdmmc_command *cmd)
 	acmd.c_arg = sc->sc_card.rca << 16;
 	acmd.c_flags = SCF_CMD_AC | SCF_RSP_R1;
 
+	/*
+	 * Without data, and with an R1 style response that reports
+	 * APP_CMD itself, both commands can be queued back to back on a
+	 * controller with a command queue.
+	 */
+	if (ISSET(sc->sch->flags, SDHC_F_VENDOR_REGS) &&
+	    cmd->c_data == NULL && ISSET(cmd->c_flags, SCF_RSP_IDX) &&
+	    !ISSET(cmd->c_flags, SCF_RSP_136)) {
+		chain[0] = acmd;
+		chain[1] = *cmd;
+		sdhc_exec_command_chain(sc->sch, chain, 2);
+		*cmd = chain[1];
+		if (cmd->c_error != 0)
+			return cmd->c_error;
+		if (!ISSET(MMC_R1(cmd->c_resp), MMC_R1_APP_CMD)) {
+			DPRINTF(1,("%s: Card does not support ACMD %x\n",
+			    DEVNAME(sc), cmd->c_resp[0]));
+			return ENODEV;
+		}
+		return 0;
+	}
+
 	error = sdmmc_mmc_command(sc, &acmd);
 	if (error != 0) {
 		return error;
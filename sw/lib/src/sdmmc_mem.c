@@ -50,6 +50,12 @@ int	sdmmc_mem_single_read_block(struct sdmmc_function *, int, u_char *,
 	size_t);
 int	sdmmc_mem_single_write_block(struct sdmmc_function *, int, u_char *,
 	size_t);
+int	sdmmc_mem_read_block_subr(struct sdmmc_function *,
+	struct sdmmc_dmamap *, int, u_char *, size_t);
+int	sdmmc_mem_write_block_subr(struct sdmmc_function *,
+	struct sdmmc_dmamap *, int, u_char *, size_t);
+int	sdmmc_mem_rw_block_sg(struct sdmmc_function *, int,
+	struct sdmmc_dmamap *, int);
 
 #ifdef SDMMC_DEBUG
 #define DPRINTF(s)	printf s
@@ -372,6 +378,7 @@ sdmmc_mem_decode_scr(struct sdmmc_softc *sc, uint32_t *raw_scr,
 	ver = SCR_STRUCTURE(resp);
 	sf->scr.sd_spec = SCR_SD_SPEC(resp);
 	sf->scr.bus_width = SCR_SD_BUS_WIDTHS(resp);
+	sf->scr.cmd23 = SCR_CMD_SUPPORT_CMD23(resp);
 
 	DPRINTF(("%s: %s: %08x%08x ver=%d, spec=%d, bus width=%d\n",
 	    DEVNAME(sc), __func__, resp[1], resp[0],
@@ -598,9 +605,7 @@ sdmmc_mem_execute_tuning(struct sdmmc_softc *sc, struct sdmmc_function *sf)
 	DPRINTF(("%s: execute tuning for timing %d\n", DEVNAME(sc),
 	    timing));
 
-	// TODO
-	//return sdhc_execute_tuning(sc->sch, timing);
-	return 0;
+	return sdhc_execute_tuning(sc->sch, timing);
 }
 
 int
@@ -608,7 +613,7 @@ sdmmc_mem_sd_init(struct sdmmc_softc *sc, struct sdmmc_function *sf)
 {
 	DFUNC(sdmmc_mem_sd_init);
 
-	int support_func, best_func, error, i;
+	int support_func, best_func, timing, error, i;
 
 	/*
 	 * All SD cards are supposed to support Default Speed mode
@@ -705,8 +710,13 @@ sdmmc_mem_sd_init(struct sdmmc_softc *sc, struct sdmmc_function *sf)
 		sdmmc_delay(1000);
 
 		/* change bus clock */
-		error = sdhc_bus_clock(sc->sch,
-		    sf->csd.tran_speed, SDMMC_TIMING_HIGHSPEED);
+		if (best_func == SD_ACCESS_MODE_SDR50)
+			timing = SDMMC_TIMING_UHS_SDR50;
+		else if (best_func == SD_ACCESS_MODE_SDR104)
+			timing = SDMMC_TIMING_UHS_SDR104;
+		else
+			timing = SDMMC_TIMING_HIGHSPEED;
+		error = sdhc_bus_clock(sc->sch, sf->csd.tran_speed, timing);
 		if (error) {
 			DPRINTF(("%s: can't change bus clock\n", DEVNAME(sc)));
 			return error;
@@ -864,9 +874,10 @@ sdmmc_mem_mmc_init(struct sdmmc_softc *sc, struct sdmmc_function *sf)
 
 			sdmmc_delay(10000);
 
+			/* DDR52 also runs at 3V, stay there on v2 hosts. */
 			error = sdhc_signal_voltage(sc->sch,
 			    SDMMC_SIGNAL_VOLTAGE_180);
-			if (error) {
+			if (error && error != EINVAL) {
 				DPRINTF(("%s: can't switch signalling voltage\n",
 				    DEVNAME(sc)));
 				return error;
@@ -976,7 +987,8 @@ sdmmc_mem_set_blocklen(struct sdmmc_softc *sc, struct sdmmc_function *sf)
 }
 
 int
-sdmmc_mem_read_block_subr(struct sdmmc_function *sf, int blkno, u_char *data, size_t datalen)
+sdmmc_mem_read_block_subr(struct sdmmc_function *sf, struct sdmmc_dmamap *dmap,
+    int blkno, u_char *data, size_t datalen)
 {
 	DFUNC(sdmmc_mem_read_block_subr);
 
@@ -987,6 +999,7 @@ sdmmc_mem_read_block_subr(struct sdmmc_function *sf, int blkno, u_char *data, si
 	bzero(&cmd, sizeof cmd);
 	cmd.c_data = data;
 	cmd.c_datalen = datalen;
+	cmd.c_dmamap = dmap;
 	cmd.c_blklen = sf->csd.sector_size;
 	cmd.c_opcode = (datalen / cmd.c_blklen) > 1 ?
 	    MMC_READ_BLOCK_MULTIPLE : MMC_READ_BLOCK_SINGLE;
@@ -994,13 +1007,19 @@ sdmmc_mem_read_block_subr(struct sdmmc_function *sf, int blkno, u_char *data, si
 		cmd.c_arg = blkno;
 	else
 		cmd.c_arg = blkno << 9;
+	cmd.c_argstep = (sf->flags & SFF_SDHC) ? 1 : cmd.c_blklen;
 	cmd.c_flags = SCF_CMD_ADTC | SCF_CMD_READ | SCF_RSP_R1;
+	if (cmd.c_opcode == MMC_READ_BLOCK_MULTIPLE && sf->scr.cmd23)
+		SET(cmd.c_flags, SCF_AUTO_CMD23);
 
 	error = sdmmc_mmc_command(sc, &cmd);
+	sf->resid = cmd.c_resid;
 	if (error != 0)
 		goto err;
 
+	/* A transfer announced with CMD23 stops by itself. */
 	if (ISSET(sc->sc_flags, SMF_STOP_AFTER_MULTIPLE) &&
+	    !ISSET(cmd.c_flags, SCF_AUTO_CMD23) &&
 	    cmd.c_opcode == MMC_READ_BLOCK_MULTIPLE) {
 		bzero(&cmd, sizeof cmd);
 		cmd.c_opcode = MMC_STOP_TRANSMISSION;
@@ -1036,7 +1055,7 @@ sdmmc_mem_single_read_block(struct sdmmc_function *sf, int blkno, u_char *data,
 	int i;
 
 	for (i = 0; i < datalen / sf->csd.sector_size; i++) {
-		error = sdmmc_mem_read_block_subr(sf, blkno + i,
+		error = sdmmc_mem_read_block_subr(sf, NULL, blkno + i,
 		    data + i * sf->csd.sector_size, sf->csd.sector_size);
 		if (error)
 			break;
@@ -1062,7 +1081,7 @@ sdmmc_mem_read_block(struct sdmmc_function *sf, int blkno, u_char *data,
 	}
 
 	if (!ISSET(sc->sc_caps, SMC_CAPS_DMA)) {
-		error = sdmmc_mem_read_block_subr(sf, blkno,
+		error = sdmmc_mem_read_block_subr(sf, NULL, blkno,
 		    data, datalen);
 		goto out;
 	}
@@ -1092,7 +1111,8 @@ out:
 }
 
 int
-sdmmc_mem_write_block_subr(struct sdmmc_function *sf, int blkno, u_char *data, size_t datalen)
+sdmmc_mem_write_block_subr(struct sdmmc_function *sf, struct sdmmc_dmamap *dmap,
+    int blkno, u_char *data, size_t datalen)
 {
 	DFUNC(sdmmc_mem_write_block_subr);
 
@@ -1103,6 +1123,7 @@ sdmmc_mem_write_block_subr(struct sdmmc_function *sf, int blkno, u_char *data, s
 	bzero(&cmd, sizeof cmd);
 	cmd.c_data = data;
 	cmd.c_datalen = datalen;
+	cmd.c_dmamap = dmap;
 	cmd.c_blklen = sf->csd.sector_size;
 	cmd.c_opcode = (datalen / cmd.c_blklen) > 1 ?
 	    MMC_WRITE_BLOCK_MULTIPLE : MMC_WRITE_BLOCK_SINGLE;
@@ -1110,13 +1131,19 @@ sdmmc_mem_write_block_subr(struct sdmmc_function *sf, int blkno, u_char *data, s
 		cmd.c_arg = blkno;
 	else
 		cmd.c_arg = blkno << 9;
+	cmd.c_argstep = (sf->flags & SFF_SDHC) ? 1 : cmd.c_blklen;
 	cmd.c_flags = SCF_CMD_ADTC | SCF_RSP_R1;
+	if (cmd.c_opcode == MMC_WRITE_BLOCK_MULTIPLE && sf->scr.cmd23)
+		SET(cmd.c_flags, SCF_AUTO_CMD23);
 
 	error = sdmmc_mmc_command(sc, &cmd);
+	sf->resid = cmd.c_resid;
 	if (error != 0)
 		goto err;
 
+	/* A transfer announced with CMD23 stops by itself. */
 	if (ISSET(sc->sc_flags, SMF_STOP_AFTER_MULTIPLE) &&
+	    !ISSET(cmd.c_flags, SCF_AUTO_CMD23) &&
 	    cmd.c_opcode == MMC_WRITE_BLOCK_MULTIPLE) {
 		bzero(&cmd, sizeof cmd);
 		cmd.c_opcode = MMC_STOP_TRANSMISSION;
@@ -1151,7 +1178,7 @@ sdmmc_mem_single_write_block(struct sdmmc_function *sf, int blkno, u_char *data,
 	int i;
 
 	for (i = 0; i < datalen / sf->csd.sector_size; i++) {
-		error = sdmmc_mem_write_block_subr(sf, blkno + i,
+		error = sdmmc_mem_write_block_subr(sf, NULL, blkno + i,
 		    data + i * sf->csd.sector_size, sf->csd.sector_size);
 		if (error)
 			break;
@@ -1177,7 +1204,7 @@ sdmmc_mem_write_block(struct sdmmc_function *sf, int blkno, u_char *data,
 	}
 
 	if (!ISSET(sc->sc_caps, SMC_CAPS_DMA)) {
-		error = sdmmc_mem_write_block_subr(sf, blkno,
+		error = sdmmc_mem_write_block_subr(sf, NULL, blkno,
 		    data, datalen);
 		goto out;
 	}
@@ -1205,3 +1232,346 @@ out:
 	// rw_exit(&sc->sc_lock);
 	return (error);
 }
+
+/*
+ * Transfer consecutive blocks from/to a scattered buffer with a single
+ * multi block command, the host controller has to support ADMA2.
+ */
+int
+sdmmc_mem_rw_block_sg(struct sdmmc_function *sf, int blkno,
+    struct sdmmc_dmamap *dmap, int read)
+{
+	DFUNC(sdmmc_mem_rw_block_sg);
+
+	size_t datalen = 0;
+	int seg;
+
+	if (dmap->dm_nsegs == 0)
+		return EINVAL;
+
+	for (seg = 0; seg < dmap->dm_nsegs; seg++)
+		datalen += dmap->dm_segs[seg].ds_len;
+
+	if (read)
+		return sdmmc_mem_read_block_subr(sf, dmap, blkno,
+		    dmap->dm_segs[0].ds_addr, datalen);
+	else
+		return sdmmc_mem_write_block_subr(sf, dmap, blkno,
+		    dmap->dm_segs[0].ds_addr, datalen);
+}
+
+int
+sdmmc_mem_read_block_sg(struct sdmmc_function *sf, int blkno,
+    struct sdmmc_dmamap *dmap)
+{
+	return sdmmc_mem_rw_block_sg(sf, blkno, dmap, 1);
+}
+
+int
+sdmmc_mem_write_block_sg(struct sdmmc_function *sf, int blkno,
+    struct sdmmc_dmamap *dmap)
+{
+	return sdmmc_mem_rw_block_sg(sf, blkno, dmap, 0);
+}
+
+static void
+sdmmc_mem_xfer_done(struct sdhc_host *hp, struct sdmmc_command *cmd, void *arg)
+{
+	struct sdmmc_mem_xfer *xfer = arg;
+	size_t done;
+
+	xfer->error = cmd->c_error;
+	if (cmd->c_error != 0 || !ISSET(cmd->c_flags, SCF_SUSPENDED)) {
+		xfer->state = SDMMC_XFER_DONE;
+		return;
+	}
+
+	done = cmd->c_datalen - cmd->c_resid;
+	xfer->blkno += done / cmd->c_blklen;
+	xfer->data += done;
+	xfer->datalen -= done;
+	/* Suspended after the last block, there is nothing to resume. */
+	xfer->state = xfer->datalen == 0 ?
+	    SDMMC_XFER_DONE : SDMMC_XFER_SUSPENDED;
+}
+
+static int
+sdmmc_mem_xfer_submit(struct sdmmc_mem_xfer *xfer)
+{
+	struct sdmmc_function *sf = xfer->sf;
+	struct sdmmc_command *cmd = &xfer->cmd;
+
+	/*
+	 * No CMD23, a suspended transfer has to be stopped with CMD12.
+	 * The controller sends the CMD12 of a finished one by itself.
+	 */
+	bzero(cmd, sizeof *cmd);
+	cmd->c_data = xfer->data;
+	cmd->c_datalen = xfer->datalen;
+	cmd->c_blklen = sf->csd.sector_size;
+	if (xfer->read)
+		cmd->c_opcode = (xfer->datalen / cmd->c_blklen) > 1 ?
+		    MMC_READ_BLOCK_MULTIPLE : MMC_READ_BLOCK_SINGLE;
+	else
+		cmd->c_opcode = (xfer->datalen / cmd->c_blklen) > 1 ?
+		    MMC_WRITE_BLOCK_MULTIPLE : MMC_WRITE_BLOCK_SINGLE;
+	if (sf->flags & SFF_SDHC)
+		cmd->c_arg = xfer->blkno;
+	else
+		cmd->c_arg = xfer->blkno << 9;
+	cmd->c_flags = SCF_CMD_ADTC | SCF_RSP_R1;
+	if (xfer->read)
+		SET(cmd->c_flags, SCF_CMD_READ);
+
+	xfer->error = 0;
+	xfer->state = SDMMC_XFER_RUNNING;
+	return sdhc_submit_command(sf->sc->sch, cmd, sdmmc_mem_xfer_done, xfer);
+}
+
+/*
+ * Start reading or writing consecutive blocks without waiting for them,
+ * `xfer' tells when it is done.  The controller interrupt has to be
+ * routed to sdhc_intr().  Only such a transfer can be preempted by
+ * sdmmc_mem_preempt_read().
+ */
+int
+sdmmc_mem_start_block(struct sdmmc_function *sf, struct sdmmc_mem_xfer *xfer,
+    int read, int blkno, u_char *data, size_t datalen)
+{
+	DFUNC(sdmmc_mem_start_block);
+
+	int error;
+
+	xfer->sf = sf;
+	xfer->read = read;
+	xfer->blkno = blkno;
+	xfer->data = data;
+	xfer->datalen = datalen;
+
+	error = sdmmc_mem_xfer_submit(xfer);
+	if (error != 0) {
+		xfer->error = error;
+		xfer->state = SDMMC_XFER_DONE;
+	}
+	return error;
+}
+
+/*
+ * Read blocks ahead of the transfer started with sdmmc_mem_start_block().
+ * The transfer is suspended at the next block gap, the read goes out on
+ * its own and the transfer is resumed from the first block the card did
+ * not see.  A transfer that can not be suspended is waited for instead.
+ */
+int
+sdmmc_mem_preempt_read(struct sdmmc_mem_xfer *xfer, int blkno, u_char *data,
+    size_t datalen)
+{
+	DFUNC(sdmmc_mem_preempt_read);
+
+	struct sdmmc_function *sf = xfer->sf;
+	struct sdhc_host *hp = sf->sc->sch;
+	int error;
+	int timo;
+
+	if (xfer->state == SDMMC_XFER_RUNNING)
+		(void)sdhc_suspend_command(hp);
+	for (timo = SDHC_TRANSFER_TIMEOUT * 1000000;
+	    xfer->state == SDMMC_XFER_RUNNING; timo--) {
+		if (timo == 0)
+			return ETIMEDOUT;
+		if (hp->intr_poll != NULL)
+			hp->intr_poll(hp);
+		sdmmc_delay(1);
+	}
+
+	/*
+	 * Nothing is submitted now, sdhc_intr() leaves the status of this
+	 * read to sdhc_wait_intr().
+	 */
+	error = sdmmc_mem_read_block(sf, blkno, data, datalen);
+
+	if (xfer->state == SDMMC_XFER_SUSPENDED) {
+		xfer->error = sdmmc_mem_xfer_submit(xfer);
+		if (xfer->error != 0)
+			xfer->state = SDMMC_XFER_DONE;
+	}
+
+	return (error);
+}
+
+/*
+ * Streaming writes.  The stream is written to the card from `blkno' on
+ * with a single open ended CMD25, so the command setup and the CMD13
+ * polling of sdmmc_mem_write_block() are paid once per stream and not
+ * once per write.  sdmmc_stream_append() copies into the ring and hands
+ * every complete block to the controller that has room for it,
+ * sdmmc_stream_close() pads the last block and stops the CMD25.
+ */
+int
+sdmmc_stream_open(struct sdmmc_stream *st, struct sdmmc_function *sf,
+    int blkno, u_char *ring, size_t ringlen)
+{
+	DFUNC(sdmmc_stream_open);
+
+	if (ringlen == 0 || ringlen % sf->csd.sector_size != 0)
+		return EINVAL;
+
+	bzero(st, sizeof *st);
+	st->sf = sf;
+	st->ring = ring;
+	st->ringlen = ringlen;
+	st->blkno = blkno;
+	return 0;
+}
+
+/*
+ * Hand complete blocks from the ring to the controller, the CMD25 goes
+ * out with the first one.  Without `wait' it returns as soon as the
+ * controller has no more room.
+ */
+static int
+sdmmc_stream_pump(struct sdmmc_stream *st, int wait)
+{
+	struct sdmmc_function *sf = st->sf;
+	struct sdhc_host *hp = sf->sc->sch;
+	size_t blklen = sf->csd.sector_size;
+	int timo = SDHC_TRANSFER_TIMEOUT * 1000000;
+	int error;
+
+	while (st->error == 0 && st->count >= blklen) {
+		if (!st->running) {
+			bzero(&st->cmd, sizeof st->cmd);
+			st->cmd.c_data = st->ring + st->tail;
+			st->cmd.c_datalen = blklen;
+			st->cmd.c_blklen = blklen;
+			st->cmd.c_opcode = MMC_WRITE_BLOCK_MULTIPLE;
+			if (sf->flags & SFF_SDHC)
+				st->cmd.c_arg = st->blkno;
+			else
+				st->cmd.c_arg = st->blkno << 9;
+			st->cmd.c_flags = SCF_CMD_ADTC | SCF_RSP_R1;
+			st->error = sdhc_stream_start(hp, &st->cmd);
+			if (st->error != 0)
+				break;
+			st->running = 1;
+		}
+
+		error = sdhc_stream_write(hp, st->ring + st->tail, blklen);
+		if (error == EBUSY) {
+			if (!wait)
+				break;
+			if (timo-- == 0) {
+				st->error = ETIMEDOUT;
+				break;
+			}
+			sdmmc_delay(1);
+			continue;
+		}
+		if (error != 0) {
+			st->error = error;
+			st->running = 0;
+			break;
+		}
+
+		st->tail = (st->tail + blklen) % st->ringlen;
+		st->count -= blklen;
+		st->blkno++;
+		timo = SDHC_TRANSFER_TIMEOUT * 1000000;
+	}
+
+	return st->error;
+}
+
+/*
+ * Append `len' bytes to the stream.  Only waits for the controller when
+ * the ring is full.
+ */
+int
+sdmmc_stream_append(struct sdmmc_stream *st, const u_char *data, size_t len)
+{
+	DFUNC(sdmmc_stream_append);
+
+	size_t n;
+
+	while (st->error == 0 && len > 0) {
+		if (st->count == st->ringlen) {
+			(void)sdmmc_stream_pump(st, 1);
+			continue;
+		}
+
+		n = MIN(len, st->ringlen - st->count);
+		n = MIN(n, st->ringlen - st->head);
+		memcpy(st->ring + st->head, data, n);
+		st->head = (st->head + n) % st->ringlen;
+		st->count += n;
+		data += n;
+		len -= n;
+
+		(void)sdmmc_stream_pump(st, 0);
+	}
+
+	return st->error;
+}
+
+/*
+ * Hand every complete block to the controller.  A partial block stays
+ * in the ring until more data or sdmmc_stream_close() completes it.
+ */
+int
+sdmmc_stream_flush(struct sdmmc_stream *st)
+{
+	DFUNC(sdmmc_stream_flush);
+
+	return sdmmc_stream_pump(st, 1);
+}
+
+/*
+ * Pad the last block with zeros, write out everything and stop the
+ * CMD25.  Returns the first error the stream ran into.
+ */
+int
+sdmmc_stream_close(struct sdmmc_stream *st)
+{
+	DFUNC(sdmmc_stream_close);
+
+	struct sdmmc_function *sf = st->sf;
+	struct sdmmc_softc *sc = sf->sc;
+	size_t blklen = sf->csd.sector_size;
+	struct sdmmc_command cmd;
+	size_t pad;
+	int error;
+
+	/* The ring holds whole blocks, so the padding does not wrap. */
+	pad = (blklen - st->count % blklen) % blklen;
+	if (st->error == 0 && pad > 0) {
+		memset(st->ring + st->head, 0, pad);
+		st->head = (st->head + pad) % st->ringlen;
+		st->count += pad;
+	}
+	(void)sdmmc_stream_pump(st, 1);
+
+	if (!st->running)
+		return st->error;
+	st->running = 0;
+
+	error = sdhc_stream_stop(sc->sch);
+	if (st->error == 0)
+		st->error = error;
+	if (error != 0)
+		return st->error;
+
+	do {
+		bzero(&cmd, sizeof cmd);
+		cmd.c_opcode = MMC_SEND_STATUS;
+		cmd.c_arg = MMC_ARG_RCA(sf->rca);
+		cmd.c_flags = SCF_CMD_AC | SCF_RSP_R1;
+		error = sdmmc_mmc_command(sc, &cmd);
+		if (error != 0)
+			break;
+		/* XXX time out */
+	} while (!ISSET(MMC_R1(cmd.c_resp), MMC_R1_READY_FOR_DATA));
+
+	if (st->error == 0)
+		st->error = error;
+	return st->error;
+}
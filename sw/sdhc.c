@@ -29,7 +29,7 @@ unsigned int rand(void) {
 
 #define SIZE     512
 #define BLOCKS   5
-static u_char scratch[SIZE * BLOCKS] = { 0 };
+static u_char scratch[SIZE * BLOCKS] __aligned(4) = { 0 };
 _Static_assert(sizeof(scratch) >= 512, "Scratch buffer needs to be atleast 512bytes");
 
 int test_rw(int size, unsigned int seed) {
@@ -78,6 +78,175 @@ int test_rw(int size, unsigned int seed) {
     return 0;
 }
 
+static void async_done(struct sdhc_host *host, struct sdmmc_command *cmd, void *arg) {
+    *(volatile int *)arg = 1;
+}
+
+int test_async_read(int size, unsigned int seed) {
+    printf("Running async read test with size %d and seed %x\n", size, seed);
+
+    struct sdmmc_command cmd = { 0 };
+    volatile int done = 0;
+    int polls = 0;
+
+    memset((void*) scratch, 0xFF, size);
+
+    cmd.c_data = scratch;
+    cmd.c_datalen = size;
+    cmd.c_blklen = sc.sc_card.csd.sector_size;
+    cmd.c_opcode = size > cmd.c_blklen ? MMC_READ_BLOCK_MULTIPLE : MMC_READ_BLOCK_SINGLE;
+    cmd.c_arg = 0;
+    cmd.c_flags = SCF_CMD_ADTC | SCF_CMD_READ | SCF_RSP_R1;
+
+    ASSERT_OK(sdhc_submit_command(&hp, &cmd, async_done, (void *) &done));
+
+    // Without an interrupt controller, run the handler from here
+    while (!done) {
+        sdhc_intr(&hp);
+        polls++;
+    }
+    ASSERT_OK(cmd.c_error);
+
+    s_Seed = seed;
+    for (size_t i = 0; i < size; ++i) {
+        char exp = rand();
+        if (scratch[i] != exp) {
+            printf("scratch[%d] not as expected, should be %x, got %x\n", i, exp, scratch[i]);
+            return 1;
+        }
+    }
+
+    printf("Succesfuly ran async read test, %d handler calls\n", polls);
+
+    return 0;
+}
+
+static int intr_polls = 0;
+
+static void intr_poll(struct sdhc_host *host) {
+    intr_polls += sdhc_intr(host);
+}
+
+int test_intr_read(int size, unsigned int seed) {
+    printf("Running interrupt read test with size %d and seed %x\n", size, seed);
+
+    memset((void*) scratch, 0xFF, size);
+
+    // The handler takes the status before the blocking read gets to see it
+    intr_polls = 0;
+    hp.intr_poll = intr_poll;
+    int error = sdmmc_mem_read_block(&sc.sc_card, 0, scratch, size);
+    hp.intr_poll = NULL;
+    ASSERT_OK(error);
+
+    if (intr_polls == 0) {
+        printf("Handler never took an interrupt\n");
+        return 1;
+    }
+
+    s_Seed = seed;
+    for (size_t i = 0; i < size; ++i) {
+        char exp = rand();
+        if (scratch[i] != exp) {
+            printf("scratch[%d] not as expected, should be %x, got %x\n", i, exp, scratch[i]);
+            return 1;
+        }
+    }
+
+    printf("Succesfuly ran interrupt read test, %d handler calls\n", intr_polls);
+
+    return 0;
+}
+
+static u_char preempt[SIZE] __aligned(4) = { 0 };
+
+int test_preempt_read(unsigned int seed) {
+    printf("Running preempt read test with seed %x\n", seed);
+
+    struct sdmmc_mem_xfer xfer = { 0 };
+    int polls = 0;
+
+    memset((void*) scratch, 0xFF, BLOCKS * SIZE);
+    memset((void*) preempt, 0xFF, SIZE);
+
+    // The handler drives the transfer and takes the status of the preempting read
+    intr_polls = 0;
+    hp.intr_poll = intr_poll;
+    ASSERT_OK(sdmmc_mem_start_block(&sc.sc_card, &xfer, 1, 0, scratch, BLOCKS * SIZE));
+    int error = sdmmc_mem_preempt_read(&xfer, BLOCKS - 1, preempt, SIZE);
+    while (xfer.state != SDMMC_XFER_DONE) {
+        sdhc_intr(&hp);
+        polls++;
+    }
+    hp.intr_poll = NULL;
+    ASSERT_OK(error);
+    ASSERT_OK(xfer.error);
+
+    s_Seed = seed;
+    for (size_t i = 0; i < BLOCKS * SIZE; ++i) {
+        char exp = rand();
+        if (scratch[i] != exp) {
+            printf("scratch[%d] not as expected, should be %x, got %x\n", i, exp, scratch[i]);
+            return 1;
+        }
+        size_t j = i - (BLOCKS - 1) * SIZE;
+        if (i >= (BLOCKS - 1) * SIZE && preempt[j] != exp) {
+            printf("preempt[%d] not as expected, should be %x, got %x\n", j, exp, preempt[j]);
+            return 1;
+        }
+    }
+
+    printf("Succesfuly ran preempt read test, %d handler calls\n", intr_polls + polls);
+
+    return 0;
+}
+
+int test_partial_write(void) {
+    // The whole blocks are written, the half block is reported back
+    int error = sdmmc_mem_write_block(&sc.sc_card, 0, scratch, 2 * SIZE + SIZE / 2);
+    if (error != EINVAL || sc.sc_card.resid != SIZE / 2) {
+        printf("partial write returned %d with resid %d\n", error, (int) sc.sc_card.resid);
+        return 1;
+    }
+    return 0;
+}
+
+int test_rw_sg(unsigned int seed) {
+    printf("Running scatter gather test with seed %x\n", seed);
+
+    // Write the two halves of the scratch buffer in swapped order
+    struct sdmmc_dma_segment segs[2] = {
+        { .ds_addr = scratch + SIZE, .ds_len = SIZE },
+        { .ds_addr = scratch,        .ds_len = SIZE },
+    };
+    struct sdmmc_dmamap dmap = { .dm_segs = segs, .dm_nsegs = 2 };
+
+    s_Seed = seed;
+    for (size_t i = 0; i < 2 * SIZE; ++i) scratch[i] = rand();
+
+    ASSERT_OK(sdmmc_mem_write_block_sg(&sc.sc_card, 0, &dmap));
+
+    memset((void*) scratch, 0xFF, 2 * SIZE);
+
+    ASSERT_OK(sdmmc_mem_read_block(&sc.sc_card, 0, scratch, 2 * SIZE));
+
+    int err = 0;
+    s_Seed = seed;
+    for (size_t i = 0; i < 2 * SIZE; ++i) {
+        char exp = rand();
+        size_t j = (i + SIZE) % (2 * SIZE);
+        if (scratch[j] != exp) {
+            printf("scratch[%d] not as expected, should be %x, got %x\n", j, exp, scratch[j]);
+            err = 1;
+        }
+    }
+    if (err) return 1;
+
+    printf("Succesfuly ran scatter gather test\n");
+
+    return 0;
+}
+
 int main() {
     uint32_t rtc_freq = *reg32((unsigned int) &__base_regs, CHESHIRE_RTC_FREQ_REG_OFFSET);
     uint64_t reset_freq = clint_get_core_freq(rtc_freq, 2500);
@@ -93,6 +262,8 @@ int main() {
 #endif
 
 
+    /* Our own controller, its vendor registers may be used. */
+    hp.flags = SDHC_F_VENDOR_REGS;
     ASSERT_OK(sdhc_init(&hp, SDHCI_BASE_ADDR, 0, 0));
 
 // #define WITH_SD_MODEL
@@ -112,7 +283,9 @@ int main() {
     sc.sc_card.csd.capacity = 20000000;
     sc.sc_card.csd.sector_size = SIZE;
 
+    ASSERT_OK(sdhc_bus_clock(sc.sch, SDMMC_SDCLK_25MHZ, SDMMC_TIMING_LEGACY));
 #else
+    // leaves the bus in the fastest mode both sides support
     sdmmc_init(&sc, &hp, scratch);
     if (!ISSET(sc.sc_flags, SMF_CARD_ATTACHED)) {
         printf("Failed to initialize SD Card\n");
@@ -121,8 +294,6 @@ int main() {
     }
 #endif
 
-    ASSERT_OK(sdhc_bus_clock(sc.sch, SDMMC_SDCLK_25MHZ, SDMMC_TIMING_LEGACY));
-
 #ifdef WITH_SD_MODEL
     ASSERT_OK(sdmmc_mem_set_blocklen(&sc, &sc.sc_card));
 #endif
@@ -134,6 +305,16 @@ int main() {
     ASSERT_OK(test_rw(BLOCKS*SIZE, 0x70EDADA1));
     // TODO half block rw?
 
+    // Reads back the data of the multiple block test
+    ASSERT_OK(test_async_read(BLOCKS*SIZE, 0x70EDADA1));
+    ASSERT_OK(test_intr_read(BLOCKS*SIZE, 0x70EDADA1));
+    ASSERT_OK(test_preempt_read(0x70EDADA1));
+
+    ASSERT_OK(test_partial_write());
+
+    if (ISSET(hp.flags, SDHC_F_ADMA2))
+        ASSERT_OK(test_rw_sg(0x5CA77E12));
+
     printf("Success\n");
     uart_write_flush(&__base_uart);
 
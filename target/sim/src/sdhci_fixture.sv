@@ -9,36 +9,71 @@
 module sdhci_fixture #(
     parameter time         ClkPeriod      = 50ns,
     parameter int unsigned RstCycles      = 1,
-    parameter int unsigned TimeoutDivider = 1
+    parameter int unsigned TimeoutDivider = 1,
+    parameter int unsigned MemWords       = 4096,
+    parameter int unsigned NumBufferBlocks = 2,
+    parameter bit          DualPortBuffer  = 1'b0,
+    parameter int unsigned NumTuningTaps   = 8,
+    parameter int unsigned DataWidth       = 32,
+    // Run the controller on its own clock, unrelated to the bus clock of the vip
+    parameter bit          SdBaseClk       = 1'b0,
+    parameter time         SdBaseClkPeriod = 30ns
 )();
   `include "obi/typedef.svh"
 
   logic clk, rst_n;
 
-  localparam obi_pkg::obi_cfg_t sdhci_obi_cfg = obi_pkg::obi_default_cfg(32, 32, 1, '0);
+  localparam obi_pkg::obi_cfg_t sdhci_obi_cfg = obi_pkg::obi_default_cfg(32, DataWidth, 1, '0);
   `OBI_TYPEDEF_DEFAULT_ALL(sdhci_obi, sdhci_obi_cfg);
 
+  // The dma engine always moves 32 bit words
+  localparam obi_pkg::obi_cfg_t sdhci_mgr_obi_cfg = obi_pkg::obi_default_cfg(32, 32, 1, '0);
+  `OBI_TYPEDEF_DEFAULT_ALL(sdhci_mgr_obi, sdhci_mgr_obi_cfg);
+
   sdhci_obi_req_t obi_req;
   sdhci_obi_rsp_t obi_rsp;
 
+  sdhci_mgr_obi_req_t obi_mgr_req;
+  sdhci_mgr_obi_rsp_t obi_mgr_rsp;
+
   logic sdhc_dat_en, sdhc_cmd_en, sdhc_cmd, tb_cmd;
-  logic [3:0] sdhc_dat, tb_dat;
+  logic [7:0] sdhc_dat, tb_dat;
   logic sd_clk, sd_cd;
   logic interrupt;
 
+  logic sd_base_clk;
+  clk_rst_gen #(
+    .ClkPeriod    (SdBaseClkPeriod),
+    .RstClkCycles (1)
+  ) i_sd_base_clk_gen (
+    .clk_o  (sd_base_clk),
+    .rst_no ()
+  );
+
   sdhci_top_obi #(
       .ObiCfg           (sdhci_obi_cfg),
       .obi_req_t        (sdhci_obi_req_t),
       .obi_rsp_t        (sdhci_obi_rsp_t),
+      .obi_mgr_req_t    (sdhci_mgr_obi_req_t),
+      .obi_mgr_rsp_t    (sdhci_mgr_obi_rsp_t),
       .ClkPreDivLog     (0),
       .NumDebounceCycles(2),
-      .TimeoutDivider   (TimeoutDivider)
+      .TimeoutDivider   (TimeoutDivider),
+      .NumBufferBlocks  (NumBufferBlocks),
+      .DualPortBuffer   (DualPortBuffer),
+      .NumTuningTaps    (NumTuningTaps),
+      .SdBaseClk        (SdBaseClk)
   ) i_sdhci_top (
-      .clk_i  (clk),
-      .rst_ni (rst_n),
+      .clk_i        (clk),
+      .rst_ni       (rst_n),
+      .sd_base_clk_i(sd_base_clk),
 
       .obi_req_i  (obi_req),
       .obi_rsp_o  (obi_rsp),
+
+      .obi_mgr_req_o(obi_mgr_req),
+      .obi_mgr_rsp_i(obi_mgr_rsp),
+
       .sd_clk_o   (sd_clk),
       .sd_cd_ni   (sd_cd),
 
@@ -50,12 +85,43 @@ module sdhci_fixture #(
       .sd_dat_o   (sdhc_dat   ),
       .sd_dat_en_o(sdhc_dat_en),
 
+      .sd_1v8_en_o(),
+
       .interrupt_o(interrupt)
   );
 
+  // System memory for the dma engine, always grants and responds in the next cycle
+  logic [31:0] memory [MemWords];
+  logic        mem_rvalid_q;
+  logic [31:0] mem_rdata_q;
+
+  always_comb begin
+    obi_mgr_rsp         = '0;
+    obi_mgr_rsp.gnt     = obi_mgr_req.req;
+    obi_mgr_rsp.rvalid  = mem_rvalid_q;
+    obi_mgr_rsp.r.rdata = mem_rdata_q;
+  end
+
+  // Not always_ff, so testbenches can preload the memory
+  always @(posedge clk) begin
+    mem_rvalid_q <= obi_mgr_req.req;
+    if (obi_mgr_req.req) begin
+      if (obi_mgr_req.a.we) begin
+        for (int i = 0; i < 4; i++) begin
+          if (obi_mgr_req.a.be[i]) begin
+            memory[obi_mgr_req.a.addr[2+:$clog2(MemWords)]][8*i+:8] <= obi_mgr_req.a.wdata[8*i+:8];
+          end
+        end
+      end else begin
+        mem_rdata_q <= memory[obi_mgr_req.a.addr[2+:$clog2(MemWords)]];
+      end
+    end
+  end
+
   sdhci_vip #(
     .obi_req_t(sdhci_obi_req_t),
-    .obi_rsp_t(sdhci_obi_rsp_t)
+    .obi_rsp_t(sdhci_obi_rsp_t),
+    .DataWidth(DataWidth)
   ) vip (
     .clk_o      (clk),
     .rst_no     (rst_n),
@@ -0,0 +1,221 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+// Same as sdhci_fixture, but for sdhci_top_axi
+module sdhci_fixture_axi #(
+    parameter time         ClkPeriod       = 50ns,
+    parameter int unsigned RstCycles       = 1,
+    parameter int unsigned TimeoutDivider  = 1,
+    parameter int unsigned MemWords        = 4096,
+    parameter int unsigned NumBufferBlocks = 2,
+    parameter int unsigned NumTuningTaps   = 8
+)();
+  `include "obi/typedef.svh"
+  `include "axi/typedef.svh"
+
+  logic clk, rst_n;
+
+  // The vip drives obi, it is converted to the bus of the top level under test
+  localparam obi_pkg::obi_cfg_t sdhci_obi_cfg = obi_pkg::obi_default_cfg(32, 32, 1, '0);
+  `OBI_TYPEDEF_DEFAULT_ALL(sdhci_obi, sdhci_obi_cfg);
+
+  `AXI_TYPEDEF_ALL(sdhci_axi, logic [31:0], logic [0:0], logic [31:0], logic [3:0], logic [0:0])
+
+  sdhci_obi_req_t obi_req;
+  sdhci_obi_rsp_t obi_rsp;
+
+  sdhci_axi_req_t  axi_mgr_req;
+  sdhci_axi_resp_t axi_mgr_rsp;
+
+  logic sdhc_dat_en, sdhc_cmd_en, sdhc_cmd, tb_cmd;
+  logic [7:0] sdhc_dat, tb_dat;
+  logic sd_clk, sd_cd;
+  logic interrupt;
+
+  `AXI_LITE_TYPEDEF_ALL(sdhci_axi_lite, logic [31:0], logic [31:0], logic [3:0])
+
+  sdhci_axi_lite_req_t  axi_lite_req;
+  sdhci_axi_lite_resp_t axi_lite_rsp;
+
+  sdhci_top_axi #(
+      .AxiAddrWidth     (32),
+      .AxiDataWidth     (32),
+      .axi_lite_req_t   (sdhci_axi_lite_req_t),
+      .axi_lite_rsp_t   (sdhci_axi_lite_resp_t),
+      .AxiMgrDataWidth  (32),
+      .axi_mgr_req_t    (sdhci_axi_req_t),
+      .axi_mgr_rsp_t    (sdhci_axi_resp_t),
+      .ClkPreDivLog     (0),
+      .NumDebounceCycles(2),
+      .TimeoutDivider   (TimeoutDivider),
+      .NumBufferBlocks  (NumBufferBlocks),
+      .NumTuningTaps    (NumTuningTaps)
+  ) i_sdhci_top (
+      .clk_i        (clk),
+      .rst_ni       (rst_n),
+      .sd_base_clk_i(1'b0),
+
+      .axi_lite_req_i (axi_lite_req),
+      .axi_lite_rsp_o (axi_lite_rsp),
+
+      .axi_mgr_req_o(axi_mgr_req),
+      .axi_mgr_rsp_i(axi_mgr_rsp),
+
+      .sd_clk_o   (sd_clk),
+      .sd_cd_ni   (sd_cd),
+
+      .sd_cmd_i   (tb_cmd     ),
+      .sd_cmd_o   (sdhc_cmd   ),
+      .sd_cmd_en_o(sdhc_cmd_en),
+
+      .sd_dat_i   (tb_dat     ),
+      .sd_dat_o   (sdhc_dat   ),
+      .sd_dat_en_o(sdhc_dat_en),
+
+      .sd_1v8_en_o(),
+
+      .interrupt_o(interrupt)
+  );
+
+  // obi to AXI4-Lite, one transaction at a time
+  typedef enum logic [1:0] { BUS_IDLE, BUS_READ, BUS_WRITE } bus_state_e;
+  bus_state_e bus_state_q, bus_state_d;
+  logic aw_done_q, aw_done_d, w_done_q, w_done_d;
+
+  always_comb begin
+    bus_state_d = bus_state_q;
+    aw_done_d   = aw_done_q;
+    w_done_d    = w_done_q;
+
+    axi_lite_req         = '0;
+    axi_lite_req.aw.addr = obi_req.a.addr;
+    axi_lite_req.w.data  = obi_req.a.wdata;
+    axi_lite_req.w.strb  = obi_req.a.be;
+    axi_lite_req.ar.addr = obi_req.a.addr;
+
+    obi_rsp         = '0;
+    obi_rsp.r.rdata = axi_lite_rsp.r.data;
+
+    unique case (bus_state_q)
+      BUS_IDLE: begin
+        if (obi_req.req && obi_req.a.we) begin
+          axi_lite_req.aw_valid = !aw_done_q;
+          axi_lite_req.w_valid  = !w_done_q;
+          aw_done_d = aw_done_q || axi_lite_rsp.aw_ready;
+          w_done_d  = w_done_q || axi_lite_rsp.w_ready;
+          if (aw_done_d && w_done_d) begin
+            obi_rsp.gnt = 1'b1;
+            aw_done_d   = 1'b0;
+            w_done_d    = 1'b0;
+            bus_state_d = BUS_WRITE;
+          end
+        end else if (obi_req.req) begin
+          axi_lite_req.ar_valid = 1'b1;
+          if (axi_lite_rsp.ar_ready) begin
+            obi_rsp.gnt = 1'b1;
+            bus_state_d = BUS_READ;
+          end
+        end
+      end
+      BUS_READ: begin
+        axi_lite_req.r_ready = 1'b1;
+        if (axi_lite_rsp.r_valid) begin
+          obi_rsp.rvalid = 1'b1;
+          bus_state_d    = BUS_IDLE;
+        end
+      end
+      BUS_WRITE: begin
+        axi_lite_req.b_ready = 1'b1;
+        if (axi_lite_rsp.b_valid) begin
+          obi_rsp.rvalid = 1'b1;
+          bus_state_d    = BUS_IDLE;
+        end
+      end
+      default: bus_state_d = BUS_IDLE;
+    endcase
+  end
+
+  always_ff @(posedge clk or negedge rst_n) begin
+    if (!rst_n) begin
+      bus_state_q <= BUS_IDLE;
+      aw_done_q   <= 1'b0;
+      w_done_q    <= 1'b0;
+    end else begin
+      bus_state_q <= bus_state_d;
+      aw_done_q   <= aw_done_d;
+      w_done_q    <= w_done_d;
+    end
+  end
+
+  // System memory for the dma engine, one single beat transaction at a time
+  logic [31:0] memory [MemWords];
+  logic        mem_r_valid_q, mem_b_valid_q;
+  logic [31:0] mem_rdata_q;
+
+  initial begin
+    mem_r_valid_q = 1'b0;
+    mem_b_valid_q = 1'b0;
+  end
+
+  always_comb begin
+    axi_mgr_rsp          = '0;
+    axi_mgr_rsp.ar_ready = !mem_r_valid_q;
+    axi_mgr_rsp.aw_ready = !mem_b_valid_q && axi_mgr_req.w_valid;
+    axi_mgr_rsp.w_ready  = !mem_b_valid_q && axi_mgr_req.aw_valid;
+    axi_mgr_rsp.r_valid  = mem_r_valid_q;
+    axi_mgr_rsp.r.data   = mem_rdata_q;
+    axi_mgr_rsp.r.last   = 1'b1;
+    axi_mgr_rsp.b_valid  = mem_b_valid_q;
+  end
+
+  // Not always_ff, so testbenches can preload the memory
+  always @(posedge clk) begin
+    if (axi_mgr_req.r_ready) begin
+      mem_r_valid_q <= 1'b0;
+    end
+    if (axi_mgr_req.ar_valid && !mem_r_valid_q) begin
+      mem_r_valid_q <= 1'b1;
+      mem_rdata_q   <= memory[axi_mgr_req.ar.addr[2+:$clog2(MemWords)]];
+    end
+
+    if (axi_mgr_req.b_ready) begin
+      mem_b_valid_q <= 1'b0;
+    end
+    if (axi_mgr_req.aw_valid && axi_mgr_req.w_valid && !mem_b_valid_q) begin
+      mem_b_valid_q <= 1'b1;
+      for (int i = 0; i < 4; i++) begin
+        if (axi_mgr_req.w.strb[i]) begin
+          memory[axi_mgr_req.aw.addr[2+:$clog2(MemWords)]][8*i+:8] <= axi_mgr_req.w.data[8*i+:8];
+        end
+      end
+    end
+  end
+
+  sdhci_vip #(
+    .obi_req_t(sdhci_obi_req_t),
+    .obi_rsp_t(sdhci_obi_rsp_t)
+  ) vip (
+    .clk_o      (clk),
+    .rst_no     (rst_n),
+
+    .obi_req_o  (obi_req),
+    .obi_rsp_i  (obi_rsp),
+    .sd_clk_i   (sd_clk),
+    .sd_cd_no   (sd_cd),
+
+    .sd_cmd_o   (tb_cmd),
+    .sd_cmd_i   (sdhc_cmd),
+    .sd_cmd_en_i(sdhc_cmd_en),
+
+    .sd_dat_o   (tb_dat),
+    .sd_dat_i   (sdhc_dat),
+    .sd_dat_en_i(sdhc_dat_en),
+
+    .interrupt_i(interrupt)
+  );
+
+endmodule
@@ -8,6 +8,7 @@
 module sdhci_obi_driver #(
   parameter type obi_req_t = logic,
   parameter type obi_rsp_t = logic,
+  parameter int unsigned DataWidth = 32,
   parameter time TA = 5ns,
   parameter time TT = 15ns
 )(
@@ -18,14 +19,16 @@ module sdhci_obi_driver #(
   input  obi_rsp_t obi_rsp_i
 );
 
+  localparam int unsigned NumLanes = DataWidth / 32;
+
   initial begin
     obi_req_o = '0;
   end
 
-  task automatic obi_write(
-    logic [31:0] address,
-    logic [3:0]  be,
-    logic [31:0] data,
+  task automatic obi_write_wide(
+    logic [31:0]            address,
+    logic [DataWidth/8-1:0] be,
+    logic [DataWidth-1:0]   data,
     logic finish_transaction = 1'b1
   );
     @(posedge clk_i);
@@ -50,10 +53,10 @@ module sdhci_obi_driver #(
     end
   endtask
 
-  task automatic obi_read(
-    logic [31:0] address,
-    logic [3:0]  be,
-    output logic [31:0] data
+  task automatic obi_read_wide(
+    logic [31:0]            address,
+    logic [DataWidth/8-1:0] be,
+    output logic [DataWidth-1:0] data
   );
     @(posedge clk_i);
     #(TA);
@@ -81,6 +84,31 @@ module sdhci_obi_driver #(
     data = obi_rsp_i.r.rdata;
   endtask
 
+  // 32 bit register accesses, placed in the lane selected by the address on wider buses
+  task automatic obi_write(
+    logic [31:0] address,
+    logic [3:0]  be,
+    logic [31:0] data,
+    logic finish_transaction = 1'b1
+  );
+    int unsigned lane;
+    lane = (address / 4) % NumLanes;
+    obi_write_wide(address, (DataWidth/8)'(be) << (lane * 4), DataWidth'(data) << (lane * 32),
+                   finish_transaction);
+  endtask
+
+  task automatic obi_read(
+    logic [31:0] address,
+    logic [3:0]  be,
+    output logic [31:0] data
+  );
+    int unsigned lane;
+    logic [DataWidth-1:0] wide_data;
+    lane = (address / 4) % NumLanes;
+    obi_read_wide(address, (DataWidth/8)'(be) << (lane * 4), wide_data);
+    data = wide_data[lane*32 +: 32];
+  endtask
+
   task automatic set_interrupt_status_enable(
     logic [15:0] normal_interrupt_status_enable = '0,
     logic [15:0] error_interrupt_status_enable  = '0,
@@ -141,32 +169,61 @@ module sdhci_obi_driver #(
     logic auto_cmd12_enable,
     logic block_count_enable,
     logic dma_enable,
-    logic finish_transaction = 1'b1
+    logic finish_transaction = 1'b1,
+    logic auto_cmd23_enable = 1'b0
   );
     logic [3:0] be;
     be = 4'b0001;
-    obi_write('h00C, be, {24'b0, 2'b0, is_multi_block, is_read, 1'b0,
+    obi_write('h00C, be, {24'b0, 2'b0, is_multi_block, is_read, auto_cmd23_enable,
                           auto_cmd12_enable, block_count_enable, dma_enable}, finish_transaction);
   endtask
 
   task automatic set_host_control_1(
     /* logic       card_detect_signal_selection, */
     /* logic       card_detect_test_level, */
-    /* logic       do_8_bit_transfer, */
     logic [1:0] dma_select,
     logic       high_speed_enable,
     logic       do_4_bit_transfer,
     /* logic       led_control, */
-    logic finish_transaction
+    logic finish_transaction,
+    logic       do_8_bit_transfer = 1'b0
   );
     logic [3:0] be;
     be = 4'b0001;
-    obi_write('h028, be, {24'b0, 3'b0, dma_select, high_speed_enable, do_4_bit_transfer, 1'b0}, finish_transaction);
+    obi_write('h028, be, {24'b0, 2'b0, do_8_bit_transfer, dma_select, high_speed_enable, do_4_bit_transfer, 1'b0},
+              finish_transaction);
+  endtask
+
+  task automatic set_host_control_2(
+    logic       execute_tuning,
+    logic       sampling_clock_select,
+    logic [2:0] uhs_mode_select,
+    logic finish_transaction = 1'b1
+  );
+    logic [3:0] be;
+    be = 4'b0100;
+    obi_write('h03C, be, {8'b0, sampling_clock_select, execute_tuning, 3'b0, uhs_mode_select, 16'b0},
+              finish_transaction);
+  endtask
+
+  task automatic get_host_control_2(
+    output logic       execute_tuning,
+    output logic       sampling_clock_select,
+    output logic [2:0] uhs_mode_select
+  );
+    logic [3:0] be;
+    logic [31:0] response;
+    be = 4'b1100;
+    obi_read('h03C, be, response);
+    sampling_clock_select = response[23];
+    execute_tuning        = response[22];
+    uhs_mode_select       = response[18:16];
   endtask
 
   task automatic set_block_size_count(
     logic [11:0] block_size,
     logic [15:0] block_count,
+    logic [2:0]  dma_buffer_boundary = '0,
     logic set_size = 1'b1,
     logic set_count = 1'b1,
     logic finish_transaction = 1'b1
@@ -180,7 +237,37 @@ module sdhci_obi_driver #(
       be[3:2] = 2'b11;
     end
 
-    obi_write('h004, be, {block_count, 4'b0, block_size}, finish_transaction);
+    obi_write('h004, be, {block_count, 1'b0, dma_buffer_boundary, block_size}, finish_transaction);
+  endtask
+
+  task automatic set_block_gap_control(
+    logic stop_at_block_gap_request,
+    logic continue_request,
+    logic read_wait_control = 1'b0,
+    logic finish_transaction = 1'b1
+  );
+    logic [3:0] be;
+    be = 4'b0100;
+    obi_write('h028, be, {8'b0, 4'b0, 1'b0, read_wait_control, continue_request,
+                          stop_at_block_gap_request, 16'b0}, finish_transaction);
+  endtask
+
+  task automatic set_system_address(
+    logic [31:0] address,
+    logic finish_transaction = 1'b1
+  );
+    logic [3:0] be;
+    be = 4'b1111;
+    obi_write('h000, be, address, finish_transaction);
+  endtask
+
+  task automatic set_adma_system_address(
+    logic [31:0] address,
+    logic finish_transaction = 1'b1
+  );
+    logic [3:0] be;
+    be = 4'b1111;
+    obi_write('h058, be, address, finish_transaction);
   endtask
 
   task automatic set_data_timeout(
@@ -225,6 +312,54 @@ module sdhci_obi_driver #(
     obi_write('h020, be, data, finish_transaction);
   endtask
 
+  task automatic read_buffer_window(
+    output logic [DataWidth-1:0] data,
+    input  int unsigned offset = 0
+  );
+    obi_read_wide('h200 + offset, '1, data);
+  endtask
+
+  task automatic write_buffer_window(
+    logic [DataWidth-1:0] data,
+    int unsigned offset = 0,
+    logic finish_transaction = 1'b1
+  );
+    obi_write_wide('h200 + offset, '1, data, finish_transaction);
+  endtask
+
+  task automatic get_buffer_data_window_width(
+    output logic [7:0] width
+  );
+    logic [3:0] be;
+    logic [31:0] response;
+    be = 4'b0001;
+    obi_read('h0C4, be, response);
+    width = response[7:0];
+  endtask
+
+  task automatic set_interrupt_coalescing(
+    logic [7:0] event_threshold,
+    logic [15:0] timeout,
+    logic finish_transaction = 1'b1
+  );
+    logic [3:0] be;
+    be = 4'b1111;
+    obi_write('h0C8, be, {timeout, 8'b0, event_threshold}, finish_transaction);
+  endtask
+
+  task automatic set_buffer_control(
+    logic write_prefill,
+    logic [7:0] cut_through_words = 8'd0,
+    logic [7:0] read_watermark = 8'd0,
+    logic [7:0] write_watermark = 8'd0,
+    logic finish_transaction = 1'b1
+  );
+    logic [3:0] be;
+    be = 4'b1111;
+    obi_write('h0CC, be, {write_watermark, read_watermark, cut_through_words, 7'b0, write_prefill},
+              finish_transaction);
+  endtask
+
   task automatic get_interrupt_status(
     output logic [15:0] normal_interrupt_status,
     output logic [15:0] error_interrupt_status
@@ -253,6 +388,32 @@ module sdhci_obi_driver #(
     error_status = response[7:0];
   endtask
 
+  task automatic get_response0(
+    output logic [31:0] response0
+  );
+    logic [3:0] be;
+    be = 4'b1111;
+    obi_read('h010, be, response0);
+  endtask
+
+  task automatic get_response3(
+    output logic [31:0] response3
+  );
+    logic [3:0] be;
+    be = 4'b1111;
+    obi_read('h01C, be, response3);
+  endtask
+
+  task automatic get_command_queue_free_entries(
+    output logic [7:0] free_entries
+  );
+    logic [3:0] be;
+    logic [31:0] response;
+    be = 4'b0001;
+    obi_read('h0C0, be, response);
+    free_entries = response[7:0];
+  endtask
+
   task automatic get_present_status_buffer_enable(
     output logic buffer_read_enable,
     output logic buffer_write_enable
@@ -264,4 +425,14 @@ module sdhci_obi_driver #(
     buffer_read_enable = response[11];
     buffer_write_enable = response[10];
   endtask
+
+  task automatic get_block_count(
+    output logic [15:0] block_count
+  );
+    logic [3:0] be;
+    logic [31:0] response;
+    be = 4'b1100;
+    obi_read('h004, be, response);
+    block_count = response[31:16];
+  endtask
 endmodule
@@ -15,8 +15,8 @@ module sdhci_sd_driver #(
   input  logic sd_cmd_i,
   input  logic sd_cmd_en_i,
 
-  output logic [3:0] sd_dat_o,
-  input  logic [3:0] sd_dat_i,
+  output logic [7:0] sd_dat_o,
+  input  logic [7:0] sd_dat_i,
   input  logic       sd_dat_en_i
 );
 
@@ -141,16 +141,21 @@ module sdhci_sd_driver #(
 
   task automatic send_byte(
     logic [7:0] data,
-    logic is_4_bit
+    logic is_4_bit,
+    logic is_8_bit = 1'b0
   );
-    if (is_4_bit) begin
+    if (is_8_bit) begin
+      @(posedge sd_clk_i);
+      #(TA);
+      sd_dat_o = data;
+    end else if (is_4_bit) begin
       @(posedge sd_clk_i);
       #(TA);
-      sd_dat_o = data[7:4];
+      sd_dat_o[3:0] = data[7:4];
 
       @(posedge sd_clk_i);
       #(TA);
-      sd_dat_o = data[3:0];
+      sd_dat_o[3:0] = data[3:0];
     end else begin
       for (int i = 0; i < 8; ++i) begin
         @(posedge sd_clk_i);
@@ -163,22 +168,43 @@ module sdhci_sd_driver #(
   task automatic send_data_block(
     logic [511:0][7:0] block,
     logic [9:0] block_size,
-    logic is_4_bit
+    logic is_4_bit,
+    logic is_8_bit = 1'b0
   );
     // start bit
     @(posedge sd_clk_i);
     #(TA);
-    if (is_4_bit) begin
+    if (is_8_bit) begin
       sd_dat_o = '0;
+    end else if (is_4_bit) begin
+      sd_dat_o[3:0] = '0;
     end else begin
       sd_dat_o[0] = '0;
     end
 
     for (int i = 0; i < block_size; i++) begin
-      send_byte(.data(block[i]), .is_4_bit(is_4_bit));
+      send_byte(.data(block[i]), .is_4_bit(is_4_bit), .is_8_bit(is_8_bit));
     end
 
-    if (is_4_bit) begin
+    if (is_8_bit) begin
+      logic [7:0][511:0] dat_channels;
+      logic [7:0][15:0]  dat_crc;
+      // Every line carries one bit of each byte, the first byte ends up in the msb
+      for (int j = 0; j < 8; ++j) begin
+        dat_channels[j] = '0;
+        for (int i = 0; i < block_size; ++i) begin
+          dat_channels[j][block_size-1-i] = block[i][j];
+        end
+        dat_crc[j] = calculate_crc16(.data(4096'(dat_channels[j])), .data_length(block_size));
+      end
+      for (int i = 0; i < 16; ++i) begin
+        @(posedge sd_clk_i);
+        #(TA);
+        for (int j = 0; j < 8; ++j) begin
+          sd_dat_o[j] = dat_crc[j][15 - i];
+        end
+      end
+    end else if (is_4_bit) begin
       logic [511:0][7:0] reversed_block;
       logic [3:0][1023:0] dat_channels;
       logic [3:0][15:0]   dat_crc;
@@ -214,6 +240,60 @@ module sdhci_sd_driver #(
     sd_dat_o = '1;
   endtask
 
+  // Samples a data block sent by the host and checks its crc
+  task automatic receive_data_block(
+    output logic [511:0][7:0] block,
+    output logic crc_ok,
+    input  logic [9:0] block_size,
+    input  logic is_4_bit
+  );
+    logic [3:0][15:0] dat_crc;
+
+    block = '0;
+    wait_for_dat_held();
+    // start bit
+    while (sd_dat_i[0] != 1'b0) begin
+      @(posedge sd_clk_i);
+      #(TT);
+    end
+
+    for (int i = 0; i < block_size; i++) begin
+      if (is_4_bit) begin
+        @(posedge sd_clk_i);
+        #(TT);
+        block[i][7:4] = sd_dat_i[3:0];
+        @(posedge sd_clk_i);
+        #(TT);
+        block[i][3:0] = sd_dat_i[3:0];
+      end else begin
+        for (int b = 7; b >= 0; b--) begin
+          @(posedge sd_clk_i);
+          #(TT);
+          block[i][b] = sd_dat_i[0];
+        end
+      end
+    end
+
+    for (int i = 0; i < 16; ++i) begin
+      @(posedge sd_clk_i);
+      #(TT);
+      for (int j = 0; j < 4; ++j) begin
+        dat_crc[j][15 - i] = sd_dat_i[j];
+      end
+    end
+
+    if (is_4_bit) begin
+      logic [3:0][1023:0] dat_channels;
+      dat_channels = split_data_into_dat_channels(.block(reverse_bytes(block, block_size)), .block_size(block_size));
+      crc_ok = 1'b1;
+      for (int j = 0; j < 4; ++j) begin
+        crc_ok &= dat_crc[j] == calculate_crc16(.data(dat_channels[j]), .data_length(block_size * 2));
+      end
+    end else begin
+      crc_ok = dat_crc[0] == calculate_crc16(.data(reverse_bytes(block, block_size)), .data_length(block_size * 8));
+    end
+  endtask
+
   function automatic logic [511:0][7:0] reverse_bytes(
     logic [511:0][7:0] data,
     int data_length
@@ -290,12 +370,13 @@ module sdhci_sd_driver #(
     logic [511:0][7:0] block,
     logic [9:0] block_size,
     logic is_4_bit,
-    output logic was_interrupted
+    output logic was_interrupted,
+    input  logic is_8_bit = 1'b0
   );
     fork
       fork
         begin
-          send_data_block(.block(block), .block_size(block_size), .is_4_bit(is_4_bit));
+          send_data_block(.block(block), .block_size(block_size), .is_4_bit(is_4_bit), .is_8_bit(is_8_bit));
           was_interrupted = 1'b0;
         end
         begin
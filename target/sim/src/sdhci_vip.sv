@@ -9,6 +9,7 @@
 module sdhci_vip #(
   parameter type obi_req_t = logic,
   parameter type obi_rsp_t = logic,
+  parameter int unsigned DataWidth = 32,
 
   parameter int unsigned RstCycles = 5,
 
@@ -29,8 +30,8 @@ module sdhci_vip #(
   input  logic sd_cmd_i,
   input  logic sd_cmd_en_i,
 
-  output logic [3:0] sd_dat_o,
-  input  logic [3:0] sd_dat_i,
+  output logic [7:0] sd_dat_o,
+  input  logic [7:0] sd_dat_i,
   input  logic       sd_dat_en_i,
 
   input  logic interrupt_i
@@ -46,6 +47,7 @@ module sdhci_vip #(
   sdhci_obi_driver #(
     .obi_req_t(obi_req_t),
     .obi_rsp_t(obi_rsp_t),
+    .DataWidth(DataWidth),
     .TA(TA),
     .TT(TT)
   ) obi (
@@ -111,4 +113,224 @@ module sdhci_vip #(
     sd_cd_no = card_absent;
   endtask
 
+  // Shared by the testbenches, so each of them only spells out what it checks
+
+  task automatic wfi(input int unsigned timeout_cycles, string error_context);
+    fork
+      begin
+        fork
+          begin
+            wait_for_interrupt();
+          end
+          begin
+            repeat(timeout_cycles) wait_for_sdclk();
+            $fatal(1, "Interrupt timed out waiting for %s", error_context);
+          end
+        join_any
+        disable fork;
+      end
+    join
+  endtask
+
+  // Reads and clears the interrupt status until it stays clear, everything seen has to match
+  task automatic check_irq(logic [15:0] expected_normal, logic [15:0] expected_error, string error_context);
+    logic [15:0] error_interrupt_status;
+    logic [15:0] error_interrupt_status_all;
+    logic [15:0] normal_interrupt_status;
+    logic [15:0] normal_interrupt_status_all;
+
+    normal_interrupt_status_all = '0;
+    error_interrupt_status_all  = '0;
+
+    obi.get_interrupt_status(
+      .normal_interrupt_status(normal_interrupt_status),
+      .error_interrupt_status(error_interrupt_status)
+    );
+
+    while (normal_interrupt_status || error_interrupt_status) begin
+      obi.clear_interrupt_status(
+        .normal_interrupt_status(normal_interrupt_status),
+        .error_interrupt_status(error_interrupt_status)
+      );
+
+      normal_interrupt_status_all |= normal_interrupt_status;
+      error_interrupt_status_all  |= error_interrupt_status;
+
+      obi.get_interrupt_status(
+        .normal_interrupt_status(normal_interrupt_status),
+        .error_interrupt_status(error_interrupt_status)
+      );
+    end
+
+    if (error_interrupt_status_all != expected_error) begin
+      $fatal(1, "Unexpected error interrupt status, got %x, expected %x (%s)", error_interrupt_status_all, expected_error, error_context);
+    end
+
+    if (normal_interrupt_status_all != expected_normal) begin
+      $fatal(1, "Unexpected normal interrupt status, got %x, expected %x (%s)", normal_interrupt_status_all, expected_normal, error_context);
+    end
+  endtask
+
+  // Collects interrupts until all of `expected_normal` were seen, no error may show up
+  task automatic wait_irq(logic [15:0] expected_normal, int unsigned timeout_cycles, string error_context);
+    logic [15:0] error_interrupt_status;
+    logic [15:0] normal_interrupt_status;
+    logic [15:0] normal_interrupt_status_all;
+
+    normal_interrupt_status_all = '0;
+    while ((normal_interrupt_status_all & expected_normal) != expected_normal) begin
+      wfi(timeout_cycles, error_context);
+
+      obi.get_interrupt_status(
+        .normal_interrupt_status(normal_interrupt_status),
+        .error_interrupt_status(error_interrupt_status)
+      );
+      obi.clear_interrupt_status(
+        .normal_interrupt_status(normal_interrupt_status),
+        .error_interrupt_status(error_interrupt_status)
+      );
+
+      if (error_interrupt_status != '0) begin
+        $fatal(1, "Unexpected error interrupt status %x (%s)", error_interrupt_status, error_context);
+      end
+      normal_interrupt_status_all |= normal_interrupt_status;
+    end
+  endtask
+
+  // Enables and signals every interrupt, sets up the bus and starts sd_clk
+  task automatic setup_host(
+    logic        do_4_bit,
+    int unsigned clk_en_period,
+    logic [1:0]  dma_select        = '0,
+    logic        do_8_bit          = 1'b0,
+    logic        high_speed_enable = 1'b1
+  );
+    obi.set_interrupt_status_enable(
+      .normal_interrupt_status_enable('hFFFF),
+      .error_interrupt_status_enable('hFFFF),
+      .finish_transaction(1'b0)
+    );
+    obi.set_interrupt_signal_enable(
+      .normal_interrupt_signal_enable('hFFFF),
+      .error_interrupt_signal_enable('hFFFF),
+      .finish_transaction(1'b0)
+    );
+
+    obi.set_host_control_1(
+      .dma_select(dma_select),
+      .high_speed_enable(high_speed_enable),
+      .do_4_bit_transfer(do_4_bit),
+      .do_8_bit_transfer(do_8_bit),
+      .finish_transaction(1'b0)
+    );
+
+    obi.set_frequency_select(
+      .divider(8'(clk_en_period >> 1)),
+      .finish_transaction(1'b0)
+    );
+    obi.set_clock_enable(.enable(1'b1), .finish_transaction(1'b1));
+  endtask
+
+  // Transfer mode, block size and count, then the command with index and crc check
+  task automatic start_data_command(
+    logic [5:0]  command_index,
+    logic        is_read,
+    int unsigned block_size,
+    int unsigned block_count,
+    logic        is_multi_block      = 1'b1,
+    logic        block_count_enable  = 1'b1,
+    logic        dma_enable          = 1'b0,
+    logic        auto_cmd12_enable   = 1'b0,
+    logic        auto_cmd23_enable   = 1'b0,
+    logic [1:0]  response_type       = 2'b10, // 48 bit no busy
+    logic [2:0]  dma_buffer_boundary = '0
+  );
+    obi.set_transfer_mode(
+      .is_multi_block(is_multi_block),
+      .is_read(is_read),
+      .auto_cmd12_enable(auto_cmd12_enable),
+      .block_count_enable(block_count_enable),
+      .dma_enable(dma_enable),
+      .auto_cmd23_enable(auto_cmd23_enable),
+      .finish_transaction(1'b0)
+    );
+
+    obi.set_block_size_count(
+      .block_size(12'(block_size)),
+      .block_count(16'(block_count)),
+      .dma_buffer_boundary(dma_buffer_boundary),
+      .finish_transaction(1'b0)
+    );
+
+    send_command(command_index, response_type, 1'b1);
+  endtask
+
+  task automatic send_command(
+    logic [5:0] command_index,
+    logic [1:0] response_type,
+    logic       data_present = 1'b0
+  );
+    obi.launch_command(
+      .command_index(command_index),
+      .command_type (2'b00), // normal command
+      .data_present (data_present),
+      .index_check_enable(1'b1),
+      .crc_check_enable(1'b1),
+      .response_type(response_type),
+      .finish_transaction(1'b1)
+    );
+  endtask
+
+  // Card side of a command with a 48 bit response
+  task automatic respond_48(logic [5:0] index, logic [6:0] crc, logic [31:0] card_status = '0);
+    sd.wait_for_cmd_held();
+    sd.wait_for_cmd_released();
+
+    // bus is idle for 2 cycles
+    wait_for_sdclk();
+    sd.send_response_48(index, crc, card_status);
+  endtask
+
+  // Card side of a multi block read, `block` is sent over and over until a command stops it
+  task automatic send_blocks_until_cmd(
+    logic [511:0][7:0] block,
+    int unsigned       block_size,
+    logic              is_4_bit,
+    logic              is_8_bit = 1'b0
+  );
+    logic was_interrupted;
+
+    was_interrupted = 1'b0;
+    while (was_interrupted == 1'b0) begin
+      wait_for_sdclk();
+      sd.send_data_block_interruptible(
+        .block(block),
+        .block_size(10'(block_size)),
+        .is_4_bit(is_4_bit),
+        .was_interrupted(was_interrupted),
+        .is_8_bit(is_8_bit)
+      );
+      repeat(100) wait_for_sdclk();
+    end
+  endtask
+
+  // Card side of a written block, takes it with a good crc status and is busy afterwards
+  task automatic accept_write_block(int unsigned busy_cycles = 20);
+    sd.wait_for_dat_held();
+    sd.wait_for_dat_released();
+
+    // crc status after 2 idle cycles
+    wait_for_sdclk();
+    sd.send_response_dat(.is_ok(1'b1));
+
+    sd.claim_busy();
+    repeat(busy_cycles) wait_for_sdclk();
+    sd.release_busy();
+  endtask
+
+  // The 8 byte pattern most read tests get from the card
+  function automatic logic [511:0][7:0] pattern_block();
+    return {64{8'hde, 8'had, 8'hbe, 8'hef, 8'hca, 8'hfe, 8'hba, 8'hbe}};
+  endfunction
+
 endmodule
@@ -0,0 +1,131 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+module tb_acmd23_block_read #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 1,
+    parameter int unsigned BlockSize     = 512,
+    parameter int unsigned BlockCount    = 2,
+    parameter logic        Do4Bit        = 1'b1
+)();
+
+  // ready for data, tran state
+  localparam logic [31:0] Cmd23Status = 32'h0000_0900;
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    // auto cmd23 comes first, a wrong index would raise an index error
+    fixture.vip.respond_48(
+      .index      ('d23),
+      .crc        ('h0E),
+      .card_status(Cmd23Status)
+    );
+
+    // then the read itself
+    fixture.vip.respond_48('d18, 'h3A);
+
+    // no cmd12 may follow
+    fork
+      begin
+        fixture.vip.sd.wait_for_cmd_held();
+        $fatal(1, "Unexpected command after a pre-defined transfer");
+      end
+    join_none
+  end
+
+  initial begin : dat_response
+    fixture.vip.wait_for_reset();
+
+    // skip cmd23, wait for the read command
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    repeat (BlockCount) begin
+      fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.send_data_block(
+        .block(fixture.vip.pattern_block()),
+        .block_size(BlockSize),
+        .is_4_bit(Do4Bit)
+      );
+      repeat(100) fixture.vip.wait_for_sdclk();
+    end
+  end
+
+  initial begin : obi_driver
+    logic [31:0] read_data;
+    logic [31:0] response3;
+    logic buffer_read_enable, buffer_write_enable;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    // argument 2
+    fixture.vip.obi.set_system_address(
+      .address(BlockCount),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.start_data_command(
+      .command_index(6'd18),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(BlockCount),
+      .auto_cmd23_enable(1'b1)
+    );
+
+    // a single command complete for cmd23 and cmd18
+    fixture.vip.wfi(400, "cmd23 + cmd18 complete");
+    fixture.vip.check_irq(
+      .expected_normal('h01), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd23 + cmd18 complete")
+    );
+
+    fixture.vip.obi.get_response3(response3);
+    if (response3 != Cmd23Status) begin
+      $fatal(1, "Auto CMD23 response not in response3, got %x", response3);
+    end
+
+    repeat (BlockCount) begin
+      fixture.vip.obi.get_present_status_buffer_enable(
+        .buffer_read_enable(buffer_read_enable),
+        .buffer_write_enable(buffer_write_enable)
+      );
+      if (!buffer_read_enable) begin
+        fixture.vip.wfi(BlockSize * 8 + 500, "data present");
+      end
+      fixture.vip.check_irq(
+        .expected_normal('h20), // data present
+        .expected_error ('h0),  // no error
+        .error_context("data present")
+      );
+      repeat (BlockSize / 4) begin
+        fixture.vip.obi.read_buffer_data(.data(read_data));
+      end
+    end
+
+    fixture.vip.wfi(200, "cmd18 transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h02), // transfer complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd18 transfer complete")
+    );
+
+    repeat (100) fixture.vip.wait_for_sdclk();
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
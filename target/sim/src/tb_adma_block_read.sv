@@ -0,0 +1,127 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+module tb_adma_block_read #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 1,
+    parameter int unsigned BlockSize     = 512,
+    parameter int unsigned BlockCount    = 4,
+    parameter logic        Do4Bit        = 1'b1,
+    parameter logic        Adma64        = 1'b0
+)();
+
+  // The first block goes to FirstWord, the rest to RestWord, linked through a second table
+  localparam int unsigned FirstWord = 1024;
+  localparam int unsigned RestWord  = 2048;
+  localparam int unsigned LinkWord  = 64;
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d18, 'h3A);
+
+    // cmd12 with busy
+    fixture.vip.respond_48('d12, 'h7A);
+  end
+
+  initial begin : dat_response
+    fixture.vip.wait_for_reset();
+
+    // wait for the read command
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    fixture.vip.send_blocks_until_cmd(fixture.vip.pattern_block(), BlockSize, Do4Bit);
+  end
+
+  task automatic write_descriptor(int unsigned word, logic [15:0] attr, logic [15:0] length, logic [31:0] address);
+    fixture.memory[word]     = {length, attr};
+    fixture.memory[word + 1] = address;
+    if (Adma64) begin
+      fixture.memory[word + 2] = '0;
+    end
+  endtask
+
+  initial begin : obi_driver
+    logic buffer_read_enable, buffer_write_enable;
+
+    // valid | tran, valid | link, valid | tran | end
+    write_descriptor(0, 'h21, 16'(BlockSize), FirstWord * 4);
+    write_descriptor(Adma64 ? 3 : 2, 'h31, '0, LinkWord * 4);
+    write_descriptor(LinkWord, 'h23, 16'(BlockSize * (BlockCount - 1)), RestWord * 4);
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod, Adma64 ? 2'b11 : 2'b10);
+
+    fixture.vip.obi.set_adma_system_address(.address('0), .finish_transaction(1'b0));
+
+    fixture.vip.start_data_command(
+      .command_index(6'd18),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(BlockCount),
+      .dma_enable(1'b1)
+    );
+
+    fixture.vip.wfi(200, "cmd18 complete");
+    fixture.vip.check_irq(
+      .expected_normal('h01), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd18 complete")
+    );
+
+    fixture.vip.wfi(BlockCount * (BlockSize * 8 + 500), "dma transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h02), // transfer complete
+      .expected_error ('h0),  // no error
+      .error_context("dma transfer complete")
+    );
+    fixture.vip.obi.get_present_status_buffer_enable(
+      .buffer_read_enable(buffer_read_enable),
+      .buffer_write_enable(buffer_write_enable)
+    );
+
+    if (buffer_read_enable) begin
+      $fatal(1, "We should no longer have data!");
+    end
+
+    fixture.vip.send_command(6'd12, 2'b11); // 48 bit with busy
+
+    fixture.vip.wfi(200, "cmd12 complete and transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h03), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd12 complete and transfer complete")
+    );
+
+    // the card sends an 8 byte pattern
+    if (fixture.memory[FirstWord] === fixture.memory[FirstWord + 1]) begin
+      $fatal(1, "DMA did not write the received data to memory");
+    end
+    for (int i = 0; i < BlockCount * BlockSize / 4; i++) begin
+      int unsigned word;
+      word = i < BlockSize / 4 ? FirstWord + i : RestWord + i - BlockSize / 4;
+      if (fixture.memory[word] !== fixture.memory[FirstWord + i % 2]) begin
+        $fatal(1, "Unexpected data at word %0d, got %x, expected %x", word, fixture.memory[word], fixture.memory[FirstWord + i % 2]);
+      end
+    end
+    if (fixture.memory[FirstWord + BlockSize / 4] !== 'x) begin
+      $fatal(1, "DMA wrote past the end of the first descriptor");
+    end
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
@@ -0,0 +1,120 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Axel Vanoni <axvanoni@student.ethz.ch>
+
+// tb_block_read, through the APB subordinate of sdhci_top_apb
+module tb_apb_block_read #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 1,
+    parameter int unsigned BlockSize     = 512,
+    parameter int unsigned BlockCount    = 2,
+    parameter logic        Do4Bit        = 1'b1,
+    parameter logic        Do8Bit        = 1'b0
+)();
+
+  sdhci_fixture_apb #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d18, 'h3A);
+
+    // cmd12 with busy
+    fixture.vip.respond_48('d12, 'h7A);
+  end
+
+  initial begin : dat_response
+    fixture.vip.wait_for_reset();
+
+    // wait for the read command
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    fixture.vip.send_blocks_until_cmd(fixture.vip.pattern_block(), BlockSize, Do4Bit, Do8Bit);
+  end
+
+  initial begin : obi_driver
+    logic [31:0] read_data;
+    logic buffer_read_enable, buffer_write_enable;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod, '0, Do8Bit);
+
+    fixture.vip.start_data_command(
+      .command_index(6'd18),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(BlockCount)
+    );
+
+    fixture.vip.wfi(200, "cmd18 complete");
+    fixture.vip.check_irq(
+      .expected_normal('h01), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd18 complete")
+    );
+
+    fixture.vip.wfi(BlockSize * 8 + 500, "first data present");
+    fixture.vip.check_irq(
+      .expected_normal('h20), // data present
+      .expected_error ('h0),  // no error
+      .error_context("first data present")
+    );
+
+    repeat (BlockCount - 1) begin
+      repeat (BlockSize / 4) begin
+        fixture.vip.obi.read_buffer_data(.data(read_data));
+      end
+      fixture.vip.obi.get_present_status_buffer_enable(
+        .buffer_read_enable(buffer_read_enable),
+        .buffer_write_enable(buffer_write_enable)
+      );
+      if (!buffer_read_enable) begin
+        fixture.vip.wfi(BlockSize * 8 + 500, "data present during loop");
+      end
+      fixture.vip.check_irq(
+        .expected_normal('h20), // data present
+        .expected_error ('h0),  // no error
+        .error_context("data present during loop")
+      );
+    end
+    repeat (BlockSize / 4) begin
+      fixture.vip.obi.read_buffer_data(.data(read_data));
+    end
+    fixture.vip.wfi(200, "cmd18 transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h02), // transfer complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd18 transfer complete")
+    );
+    fixture.vip.obi.get_present_status_buffer_enable(
+      .buffer_read_enable(buffer_read_enable),
+      .buffer_write_enable(buffer_write_enable)
+    );
+
+    if (buffer_read_enable) begin
+      $fatal(1, "We should no longer have data!");
+    end
+
+    fixture.vip.send_command(6'd12, 2'b11); // 48 bit with busy
+
+    fixture.vip.wfi(200, "cmd12 complete and transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h03), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd12 complete and transfer complete")
+    );
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
@@ -0,0 +1,202 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+// tb_dma_block_read that stops at the first block gap and continues after the event.
+// The card model ignores read wait, so the gap is held by pausing sd_clk.
+// Then a pio write that sets stop with two blocks written, both of them have to reach the card
+// before the write stops at the gap.
+module tb_block_gap #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 1,
+    parameter int unsigned BlockSize     = 512,
+    parameter int unsigned BlockCount    = 4,
+    parameter logic        Do4Bit        = 1'b1
+)();
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  int unsigned blocks_received;
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d18, 'h3A);
+
+    // cmd12 with busy
+    fixture.vip.respond_48('d12, 'h7A);
+
+    fixture.vip.respond_48('d25, 'h4B);
+    fixture.vip.respond_48('d12, 'h7A);
+  end
+
+  initial begin : dat_response
+    fixture.vip.wait_for_reset();
+
+    // wait for the read command
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    fixture.vip.send_blocks_until_cmd(fixture.vip.pattern_block(), BlockSize, Do4Bit);
+
+    blocks_received = 0;
+    repeat (BlockCount) begin
+      fixture.vip.sd.wait_for_dat_held();
+      fixture.vip.sd.wait_for_dat_released();
+      blocks_received++;
+
+      // crc status after 2 idle cycles
+      fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.send_response_dat(.is_ok(1'b1));
+
+      fixture.vip.sd.claim_busy();
+      repeat(20) fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.release_busy();
+    end
+  end
+
+  task automatic write_block();
+    logic buffer_read_enable, buffer_write_enable;
+    int unsigned polls;
+
+    polls = 0;
+    do begin
+      fixture.vip.obi.get_present_status_buffer_enable(
+        .buffer_read_enable(buffer_read_enable),
+        .buffer_write_enable(buffer_write_enable)
+      );
+      if (++polls > BlockSize * 8 + 500) begin
+        $fatal(1, "Buffer never had room for the next block");
+      end
+    end while (!buffer_write_enable);
+
+    repeat (BlockSize / 4) begin
+      fixture.vip.obi.write_buffer_data(.data(32'hdeadbeef), .finish_transaction(1'b1));
+    end
+  endtask
+
+  initial begin : obi_driver
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.obi.set_system_address(.address('0), .finish_transaction(1'b0));
+
+    fixture.vip.obi.set_block_gap_control(
+      .stop_at_block_gap_request(1'b1),
+      .continue_request(1'b0),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.start_data_command(
+      .command_index(6'd18),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(BlockCount),
+      .dma_enable(1'b1),
+      .dma_buffer_boundary(3'd7) // 512K, no dma interrupt
+    );
+
+    fixture.vip.wfi(200, "cmd18 complete");
+    fixture.vip.check_irq(
+      .expected_normal('h01), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd18 complete")
+    );
+
+    fixture.vip.wfi(BlockSize * 8 + 500, "block gap");
+    fixture.vip.check_irq(
+      .expected_normal('h04), // block gap event
+      .expected_error ('h0),  // no error
+      .error_context("block gap")
+    );
+
+    // nothing may move while stopped, sd_clk is paused
+    repeat (4 * BlockSize * ClkEnPeriod) @(posedge fixture.clk);
+    fixture.vip.check_irq(
+      .expected_normal('h00),
+      .expected_error ('h0),
+      .error_context("stopped at block gap")
+    );
+
+    fixture.vip.obi.set_block_gap_control(
+      .stop_at_block_gap_request(1'b0),
+      .continue_request(1'b1),
+      .finish_transaction(1'b1)
+    );
+
+    fixture.vip.wfi(BlockCount * (BlockSize * 8 + 500), "dma transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h02), // transfer complete
+      .expected_error ('h0),  // no error
+      .error_context("dma transfer complete")
+    );
+
+    fixture.vip.send_command(6'd12, 2'b11); // 48 bit with busy
+
+    fixture.vip.wfi(200, "cmd12 complete and transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h03), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd12 complete and transfer complete")
+    );
+
+    fixture.vip.start_data_command(
+      .command_index(6'd25),
+      .is_read(1'b0),
+      .block_size(BlockSize),
+      .block_count(BlockCount)
+    );
+    fixture.vip.wait_irq('h11, 200, "cmd25 complete"); // cmd complete, buffer write ready
+
+    // stop only once the blocks are written, what is still buffered goes out first
+    repeat (BlockCount / 2) write_block();
+    fixture.vip.obi.set_block_gap_control(
+      .stop_at_block_gap_request(1'b1),
+      .continue_request(1'b0),
+      .finish_transaction(1'b1)
+    );
+
+    fixture.vip.wait_irq('h04, BlockCount * (BlockSize * 8 + 500), "write block gap");
+    if (blocks_received != BlockCount / 2) begin
+      $fatal(1, "Write stopped after %0d blocks, expected %0d", blocks_received, BlockCount / 2);
+    end
+
+    // no further block may start while stopped
+    repeat (4 * BlockSize * ClkEnPeriod) @(posedge fixture.clk);
+    fixture.vip.check_irq(
+      .expected_normal('h00),
+      .expected_error ('h0),
+      .error_context("write stopped at block gap")
+    );
+    if (blocks_received != BlockCount / 2) begin
+      $fatal(1, "Card got block %0d while stopped at the gap", blocks_received);
+    end
+
+    fixture.vip.obi.set_block_gap_control(
+      .stop_at_block_gap_request(1'b0),
+      .continue_request(1'b1),
+      .finish_transaction(1'b1)
+    );
+    repeat (BlockCount - BlockCount / 2) write_block();
+
+    fixture.vip.wait_irq('h02, BlockCount * (BlockSize * 8 + 500), "write transfer complete");
+    if (blocks_received != BlockCount) begin
+      $fatal(1, "Card got %0d blocks, expected %0d", blocks_received, BlockCount);
+    end
+
+    fixture.vip.send_command(6'd12, 2'b11); // 48 bit with busy
+    fixture.vip.wait_irq('h01, 200, "write cmd12 complete");
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
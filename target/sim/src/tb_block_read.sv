@@ -11,7 +11,8 @@ module tb_block_read #(
     parameter int unsigned ClkEnPeriod   = 1,
     parameter int unsigned BlockSize     = 512,
     parameter int unsigned BlockCount    = 2,
-    parameter logic        Do4Bit        = 1'b1
+    parameter logic        Do4Bit        = 1'b1,
+    parameter logic        Do8Bit        = 1'b0
 )();
 
   sdhci_fixture #(
@@ -136,7 +137,8 @@ module tb_block_read #(
         .block(block),
         .block_size(BlockSize),
         .is_4_bit(Do4Bit),
-        .was_interrupted(was_interrupted)
+        .was_interrupted(was_interrupted),
+        .is_8_bit(Do8Bit)
       );
       repeat(100) fixture.vip.wait_for_sdclk();
     end
@@ -162,6 +164,7 @@ module tb_block_read #(
       .dma_select('0),
       .high_speed_enable(1'b1),
       .do_4_bit_transfer(Do4Bit),
+      .do_8_bit_transfer(Do8Bit),
       .finish_transaction(1'b0)
     );
 
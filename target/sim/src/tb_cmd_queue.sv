@@ -0,0 +1,149 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+module tb_cmd_queue #(
+  parameter time         ClkPeriod   = 50ns,
+  parameter int unsigned RstCycles   = 1,
+  parameter int unsigned NumCommands = 3
+)();
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  localparam int unsigned N_RC = 8;
+
+  int ClkEnPeriod;
+  logic [15:0] normal_interrupt_status;
+  logic [15:0] error_interrupt_status;
+  logic [31:0] response0;
+  logic [7:0]  free_entries;
+
+  initial begin : configure_tb
+    if (!$value$plusargs("ClkEnPeriod=%d", ClkEnPeriod)) begin
+      ClkEnPeriod = 4;
+    end
+    $display("Testing command queue with ClkEnPeriod=%d", ClkEnPeriod);
+  end : configure_tb
+
+  task wfi(input int unsigned timeout_cycles);
+    fork
+      begin
+        fork
+          begin
+            fixture.vip.wait_for_interrupt();
+          end
+          begin
+            repeat(timeout_cycles) fixture.vip.wait_for_sdclk();
+            $fatal("Interrupt timed out");
+          end
+        join_any
+        disable fork;
+      end
+    join
+  endtask
+
+  initial begin
+    fixture.vip.wait_for_reset();
+    fixture.vip.obi.set_interrupt_status_enable(
+      // enable command complete
+      .normal_interrupt_status_enable('h0001),
+      // enable all command errors
+      .error_interrupt_status_enable('h000F),
+      .finish_transaction(1'b0)
+    );
+    fixture.vip.obi.set_interrupt_signal_enable(
+      .normal_interrupt_signal_enable('h0001),
+      .error_interrupt_signal_enable('h000F),
+      .finish_transaction(1'b0)
+    );
+    fixture.vip.obi.set_frequency_select(
+      .divider(ClkEnPeriod >> 1),
+      .finish_transaction(1'b0)
+    );
+    fixture.vip.obi.set_clock_enable(.enable(1'b1), .finish_transaction(1'b1));
+
+    // Queue all commands without waiting for any of them
+    for (int i = 0; i < NumCommands; i++) begin
+      fixture.vip.obi.launch_command(
+        .command_index(6'd13),
+        .command_type (2'b00), // normal command
+        .data_present (1'b0),
+        .index_check_enable(1'b1),
+        .crc_check_enable(1'b0),
+        .response_type(2'b10), // 48bit no busy
+        .finish_transaction(1'b1)
+      );
+    end
+
+    // a single command complete for the whole chain
+    wfi(400 * NumCommands);
+
+    fixture.vip.obi.get_interrupt_status(
+      .normal_interrupt_status(normal_interrupt_status),
+      .error_interrupt_status(error_interrupt_status)
+    );
+    fixture.vip.obi.clear_interrupt_status(
+      .normal_interrupt_status(normal_interrupt_status),
+      .error_interrupt_status(error_interrupt_status)
+    );
+
+    if (|(error_interrupt_status)) begin
+      $fatal("Queued command failed: %h", error_interrupt_status);
+    end
+
+    fixture.vip.obi.get_response0(response0);
+    if (response0 != NumCommands) begin
+      $fatal("Expected response of the last command, got %h", response0);
+    end
+
+    fixture.vip.obi.get_command_queue_free_entries(free_entries);
+    if (free_entries == '0) begin
+      $fatal("Command queue not drained");
+    end
+
+    repeat (100) fixture.vip.assert_no_interrupt();
+
+    $display("All good");
+    $finish();
+  end
+
+  initial begin
+    int gap;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.sd.wait_for_cmd_held();
+    for (int i = 0; i < NumCommands; i++) begin
+      fixture.vip.sd.wait_for_cmd_released();
+      repeat(2) fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.send_response_48(
+        .index(6'd13),
+        .crc  (7'h0),
+        .card_status(i + 1)
+      );
+
+      if (i == NumCommands - 1) break;
+
+      // the next command has to follow after exactly N_RC idle cycles
+      gap = 0;
+      fork
+        begin
+          fixture.vip.sd.wait_for_cmd_held();
+        end
+        begin
+          forever begin
+            fixture.vip.wait_for_sdclk();
+            gap++;
+          end
+        end
+      join_any
+      disable fork;
+
+      if (gap < N_RC || gap > N_RC + 2) begin
+        $fatal("Commands %0d and %0d are %0d cycles apart", i, i + 1, gap);
+      end
+    end
+  end
+
+endmodule
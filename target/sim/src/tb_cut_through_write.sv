@@ -0,0 +1,152 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Pio single block write with cut_through_words set, the block has to start on the bus while
+// the host is still writing it. The host writes faster than the card reads, so the write has
+// to complete without an error.
+// A second block starts after two words and the host then keeps exactly one word ahead of the
+// card, that is still in time and must not poison the block.
+module tb_cut_through_write #(
+    parameter time         ClkPeriod       = 50ns,
+    parameter int unsigned RstCycles       = 1,
+    parameter int unsigned ClkEnPeriod     = 2,
+    parameter int unsigned BlockSize       = 512,
+    parameter int unsigned CutThroughWords = 16,
+    parameter logic        Do4Bit          = 1'b1
+)();
+
+  // sd_clk cycles the card needs for one word
+  localparam int unsigned WordCycles = Do4Bit ? 8 : 32;
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  logic host_done = 1'b0;
+
+  function automatic logic [31:0] paced_word(int unsigned i);
+    return 32'hdeadbeef + i;
+  endfunction
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d24, 'h7D);
+    fixture.vip.respond_48('d24, 'h7D);
+  end
+
+  initial begin : dat_response
+    logic [511:0][7:0] block;
+    logic crc_ok;
+
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.sd.wait_for_dat_held();
+    if (host_done) begin
+      $fatal(1, "Block only started once all of it was buffered");
+    end
+    fixture.vip.accept_write_block();
+
+    fixture.vip.sd.receive_data_block(
+      .block(block),
+      .crc_ok(crc_ok),
+      .block_size(BlockSize),
+      .is_4_bit(Do4Bit)
+    );
+    if (!crc_ok) begin
+      $fatal(1, "Block was poisoned although the host kept a word ahead");
+    end
+    for (int unsigned i = 0; i < BlockSize / 4; i++) begin
+      if ({block[i*4+3], block[i*4+2], block[i*4+1], block[i*4]} != paced_word(i)) begin
+        $fatal(1, "Card received %x in word %0d, expected %x",
+               {block[i*4+3], block[i*4+2], block[i*4+1], block[i*4]}, i, paced_word(i));
+      end
+    end
+    fixture.vip.sd.wait_for_dat_released();
+
+    // crc status after 2 idle cycles
+    fixture.vip.wait_for_sdclk();
+    fixture.vip.sd.send_response_dat(.is_ok(crc_ok));
+
+    fixture.vip.sd.claim_busy();
+    repeat(20) fixture.vip.wait_for_sdclk();
+    fixture.vip.sd.release_busy();
+  end
+
+  initial begin : obi_driver
+    int unsigned sd_cycles;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.obi.set_buffer_control(
+      .write_prefill(1'b0),
+      .cut_through_words(8'(CutThroughWords)),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.start_data_command(
+      .command_index(6'd24),
+      .is_read(1'b0),
+      .block_size(BlockSize),
+      .block_count(1),
+      .is_multi_block(1'b0),
+      .block_count_enable(1'b0)
+    );
+
+    // cmd complete, buffer write ready
+    fixture.vip.wait_irq('h11, BlockSize * 8 + 500, "cmd24 complete");
+
+    repeat (BlockSize / 4) begin
+      fixture.vip.obi.write_buffer_data(.data(32'hdeadbeef), .finish_transaction(1'b1));
+    end
+    host_done = 1'b1;
+
+    fixture.vip.wait_irq('h02, BlockSize * 8 + 500, "cut through write");
+
+    fixture.vip.obi.set_buffer_control(
+      .write_prefill(1'b0),
+      .cut_through_words(8'd2),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.start_data_command(
+      .command_index(6'd24),
+      .is_read(1'b0),
+      .block_size(BlockSize),
+      .block_count(1),
+      .is_multi_block(1'b0),
+      .block_count_enable(1'b0)
+    );
+
+    fixture.vip.wait_irq('h11, BlockSize * 8 + 500, "paced cmd24 complete");
+
+    fixture.vip.obi.write_buffer_data(.data(paced_word(0)), .finish_transaction(1'b1));
+    fixture.vip.obi.write_buffer_data(.data(paced_word(1)), .finish_transaction(1'b1));
+
+    // The card pops word k WordCycles * k sd_clk cycles after the start bit. Word k + 1 goes in
+    // half a word before that, when word k is the only one left in the buffer.
+    fixture.vip.sd.wait_for_dat_held();
+    sd_cycles = 0;
+    fork
+      forever begin
+        fixture.vip.wait_for_sdclk();
+        sd_cycles++;
+      end
+    join_none
+    for (int unsigned k = 1; k < BlockSize / 4 - 1; k++) begin
+      wait (sd_cycles >= WordCycles * k - WordCycles / 2);
+      fixture.vip.obi.write_buffer_data(.data(paced_word(k + 1)), .finish_transaction(1'b1));
+    end
+    disable fork;
+
+    fixture.vip.wait_irq('h02, BlockSize * 8 + 500, "paced cut through write");
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
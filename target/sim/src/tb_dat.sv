@@ -43,17 +43,17 @@ module tb_dat #(
     .sd_clk_stable_o ()
   );
 
-  tri1 [3:0] dat;
+  tri1 [7:0] dat;
 
   logic [31:0] data_i;
   logic start_write;
   logic next_word_o, done_write, dat_en_o;
-  logic [3:0] dat_o;
+  logic [7:0] dat_o;
   assign dat = dat_en_o ? dat_o : 'z;
 
   localparam int MaxBlockBitSize = 14;
 
-  logic UseWideBus;
+  logic UseWideBus, UseByteBus, UseDdr, UseHighSpeed;
   logic [MaxBlockBitSize-1:0] BlockSize;
 
   dat_write #(
@@ -68,9 +68,13 @@ module tb_dat #(
     .start_i (start_write),
     .block_size_i (MaxBlockBitSize'(BlockSize)),
     .bus_width_is_4_i (UseWideBus),
+    .bus_width_is_8_i (UseByteBus),
+    .ddr_i            (UseDdr),
+    .high_speed_i     (UseHighSpeed),
 
     .data_i,
     .next_word_o,
+    .poison_i    (1'b0),
 
     .done_o        (done_write),
     .crc_err_o     (),
@@ -88,12 +92,15 @@ module tb_dat #(
   ) i_dat_read (
     .clk_i (clk),
     .sd_clk_en_i (sd_clk_en_p),
+    .sd_clk_en_n_i (sd_clk_en_n),
     .rst_ni (rst_n),
     .dat_i (dat),
 
     .start_i (start_read),
     .block_size_i (MaxBlockBitSize'(BlockSize)),
     .bus_width_is_4_i (UseWideBus),
+    .bus_width_is_8_i (UseByteBus),
+    .ddr_i            (UseDdr),
 
     .data_valid_o,
     .data_o,
@@ -133,6 +140,15 @@ module tb_dat #(
     if (!$value$plusargs("UseWideBus=%d", UseWideBus)) begin
       UseWideBus = 1;
     end
+    if (!$value$plusargs("UseByteBus=%d", UseByteBus)) begin
+      UseByteBus = 0;
+    end
+    if (!$value$plusargs("UseDdr=%d", UseDdr)) begin
+      UseDdr = 0;
+    end
+    if (!$value$plusargs("UseHighSpeed=%d", UseHighSpeed)) begin
+      UseHighSpeed = 0;
+    end
     if (!$value$plusargs("ClkEnPeriod=%d", ClkEnPeriod)) begin
       ClkEnPeriod = 3;
     end
@@ -144,7 +160,8 @@ module tb_dat #(
     reg2hw_i.clock_control.sd_clock_enable.q = 1;
     reg2hw_i.clock_control.sdclk_frequency_select.q = 8'(ClkEnPeriod);
 
-    $display("Testing dat line with UseWideBus=%d, BlockSize=%d, ClkEnPeriod=%d", UseWideBus, BlockSize, ClkEnPeriod);
+    $display("Testing dat line with UseWideBus=%d, UseByteBus=%d, UseDdr=%d, UseHighSpeed=%d, BlockSize=%d, ClkEnPeriod=%d",
+             UseWideBus, UseByteBus, UseDdr, UseHighSpeed, BlockSize, ClkEnPeriod);
 
     #ClkPeriod;
 
@@ -203,8 +220,13 @@ module tb_dat #(
         remainingBlocks -= 4;
       end
 
-      @(negedge sd_clk);
-      @(posedge clk);
+      if (UseDdr) begin
+        // next_word_o and data_valid_o may pulse on either sd clock edge
+        @(negedge clk);
+      end else begin
+        @(negedge sd_clk);
+        @(posedge clk);
+      end
     end
 
     repeat(50) @(posedge clk);
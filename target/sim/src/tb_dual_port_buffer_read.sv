@@ -0,0 +1,14 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// tb_dma_block_read with the dual port buffer SRAM, at div_1 the card and the dma engine access
+// the buffer in the same cycles
+module tb_dual_port_buffer_read;
+
+  tb_dma_block_read #(
+    .ClkEnPeriod   (1),
+    .DualPortBuffer(1'b1)
+  ) i_tb_dma_block_read ();
+
+endmodule
@@ -0,0 +1,98 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+// tb_dma_block_read with interrupt coalescing, cmd complete is held back until the dma
+// boundary makes it two events, transfer complete is signalled right away.
+module tb_interrupt_coalescing #(
+    parameter time         ClkPeriod      = 50ns,
+    parameter int unsigned RstCycles      = 1,
+    parameter int unsigned ClkEnPeriod    = 1,
+    parameter int unsigned BlockSize      = 512,
+    parameter int unsigned BlockCount     = 16,
+    parameter logic        Do4Bit         = 1'b1,
+    // 4K boundary, the dma engine has to stop once in the middle of the transfer
+    parameter logic [2:0]  DmaBoundary    = 3'd0,
+    parameter logic [7:0]  EventThreshold = 8'd2
+)();
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d18, 'h3A);
+
+    // cmd12 with busy
+    fixture.vip.respond_48('d12, 'h7A);
+  end
+
+  initial begin : dat_response
+    fixture.vip.wait_for_reset();
+
+    // wait for the read command
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    fixture.vip.send_blocks_until_cmd(fixture.vip.pattern_block(), BlockSize, Do4Bit);
+  end
+
+  initial begin : obi_driver
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.obi.set_system_address(.address('0), .finish_transaction(1'b0));
+
+    fixture.vip.obi.set_interrupt_coalescing(
+      .event_threshold(EventThreshold),
+      .timeout('0),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.start_data_command(
+      .command_index(6'd18),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(BlockCount),
+      .dma_enable(1'b1),
+      .dma_buffer_boundary(DmaBoundary)
+    );
+
+    fixture.vip.wfi((4096 << DmaBoundary) / BlockSize * (BlockSize * 8 + 500), "dma boundary");
+    fixture.vip.check_irq(
+      .expected_normal('h09), // cmd complete, dma interrupt
+      .expected_error ('h0),  // no error
+      .error_context("dma boundary")
+    );
+
+    // continue right after the boundary
+    fixture.vip.obi.set_system_address(.address(4096 << DmaBoundary), .finish_transaction(1'b1));
+
+    fixture.vip.wfi(BlockCount * (BlockSize * 8 + 500), "dma transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h02), // transfer complete
+      .expected_error ('h0),  // no error
+      .error_context("dma transfer complete")
+    );
+
+    fixture.vip.send_command(6'd12, 2'b11); // 48 bit with busy
+
+    fixture.vip.wfi(200, "cmd12 complete and transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h03), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd12 complete and transfer complete")
+    );
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
@@ -0,0 +1,135 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+// Open ended dma read, block count enable is off so the block count register is ignored.
+// The card streams until the read is stopped at a block gap and aborted with CMD12.
+module tb_open_ended_read #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 1,
+    parameter int unsigned BlockSize     = 512,
+    parameter int unsigned MinBlocks     = 3,
+    parameter logic        Do4Bit        = 1'b1
+)();
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d18, 'h3A);
+
+    // cmd12 with busy
+    fixture.vip.respond_48('d12, 'h7A);
+  end
+
+  initial begin : dat_response
+    fixture.vip.wait_for_reset();
+
+    // wait for the read command
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    fixture.vip.send_blocks_until_cmd(fixture.vip.pattern_block(), BlockSize, Do4Bit);
+  end
+
+  initial begin : obi_driver
+    logic [15:0] block_count;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.obi.set_system_address(.address('0), .finish_transaction(1'b0));
+
+    fixture.vip.start_data_command(
+      .command_index(6'd18),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(1),
+      .block_count_enable(1'b0),
+      .dma_enable(1'b1),
+      .auto_cmd12_enable(1'b1),
+      .dma_buffer_boundary(3'd7) // 512K, no dma interrupt
+    );
+
+    fixture.vip.wfi(200, "cmd18 complete");
+    fixture.vip.check_irq(
+      .expected_normal('h01), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd18 complete")
+    );
+
+    // neither the block count nor the card stops the transfer
+    repeat (MinBlocks * (BlockSize * 8 + 500)) fixture.vip.wait_for_sdclk();
+    fixture.vip.check_irq(
+      .expected_normal('h00),
+      .expected_error ('h0),  // no error
+      .error_context("streaming")
+    );
+
+    fixture.vip.obi.set_block_gap_control(
+      .stop_at_block_gap_request(1'b1),
+      .continue_request(1'b0),
+      .finish_transaction(1'b1)
+    );
+
+    fixture.vip.wfi(BlockSize * 8 + 500, "block gap");
+    fixture.vip.check_irq(
+      .expected_normal('h04), // block gap event
+      .expected_error ('h0),  // no error
+      .error_context("block gap")
+    );
+
+    fixture.vip.obi.launch_command(
+      .command_index(6'd12),
+      .command_type (2'b11), // abort
+      .data_present (1'b0),
+      .index_check_enable(1'b1),
+      .crc_check_enable(1'b1),
+      .response_type(2'b11), // 48 bit with busy
+      .finish_transaction(1'b1)
+    );
+
+    fixture.vip.wfi(BlockSize * 8 + 500, "abort cmd12 complete and transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h03), // cmd complete, transfer complete
+      .expected_error ('h0),  // no error
+      .error_context("abort cmd12 complete and transfer complete")
+    );
+
+    fixture.vip.obi.get_block_count(block_count);
+    if (block_count != 1) begin
+      $fatal(1, "Block count changed to %0d in an open ended transfer", block_count);
+    end
+
+    // no auto cmd12 may follow
+    repeat (2 * BlockSize) fixture.vip.wait_for_sdclk();
+    fixture.vip.check_irq(
+      .expected_normal('h00),
+      .expected_error ('h0),
+      .error_context("stopped")
+    );
+
+    // the card sends an 8 byte pattern
+    if (fixture.memory[0] === fixture.memory[1]) begin
+      $fatal(1, "DMA did not write the received data to memory");
+    end
+    for (int i = 2; i < MinBlocks * BlockSize / 4; i++) begin
+      if (fixture.memory[i] !== fixture.memory[i % 2]) begin
+        $fatal(1, "Unexpected data at word %0d, got %x, expected %x", i, fixture.memory[i], fixture.memory[i % 2]);
+      end
+    end
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
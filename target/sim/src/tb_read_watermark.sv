@@ -0,0 +1,109 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Pio single block read with a read watermark, the host is told about the first words while the
+// card is still sending the block and drains it in parts of `Watermark` words.
+module tb_read_watermark #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 2,
+    parameter int unsigned BlockSize     = 512,
+    parameter int unsigned Watermark     = 16,
+    parameter logic        Do4Bit        = 1'b1
+)();
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  logic block_sent = 1'b0;
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d17, 'h60);
+  end
+
+  initial begin : dat_response
+    logic [511:0][7:0] block;
+
+    for (int i = 0; i < 512; i++) begin
+      block[i] = 8'(i);
+    end
+
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    fixture.vip.wait_for_sdclk();
+    fixture.vip.sd.send_data_block(
+      .block(block),
+      .block_size(BlockSize),
+      .is_4_bit(Do4Bit)
+    );
+    block_sent = 1'b1;
+  end
+
+  initial begin : obi_driver
+    logic [31:0] read_data, expected_data;
+    logic buffer_read_enable, buffer_write_enable;
+    int unsigned word;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.obi.set_buffer_control(
+      .write_prefill(1'b0),
+      .read_watermark(8'(Watermark)),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.start_data_command(
+      .command_index(6'd17),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(1),
+      .is_multi_block(1'b0),
+      .block_count_enable(1'b0)
+    );
+
+    // cmd complete, buffer read ready
+    fixture.vip.wait_irq('h21, BlockSize * 8 + 500, "first words");
+    if (block_sent) begin
+      $fatal(1, "Buffer read ready only came with the whole block");
+    end
+
+    word = 0;
+    while (word < BlockSize / 4) begin
+      fixture.vip.obi.get_present_status_buffer_enable(
+        .buffer_read_enable(buffer_read_enable),
+        .buffer_write_enable(buffer_write_enable)
+      );
+      if (!buffer_read_enable) begin
+        fixture.vip.wait_for_sdclk();
+        continue;
+      end
+
+      repeat (Watermark) begin
+        fixture.vip.obi.read_buffer_data(.data(read_data));
+        for (int b = 0; b < 4; b++) begin
+          expected_data[b*8 +: 8] = 8'(word * 4 + b);
+        end
+        if (read_data != expected_data) begin
+          $fatal(1, "Word %0d is %x, expected %x", word, read_data, expected_data);
+        end
+        word++;
+      end
+    end
+
+    fixture.vip.wait_irq('h02, BlockSize * 8 + 500, "transfer complete");
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
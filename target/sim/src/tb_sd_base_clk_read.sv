@@ -0,0 +1,84 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Dma multi block read with the controller on its own sd base clock. The registers, the dma port
+// and the interrupt all have to cross over to the bus clock of the vip.
+module tb_sd_base_clk_read #(
+    parameter time         ClkPeriod       = 50ns,
+    parameter time         SdBaseClkPeriod = 30ns,
+    parameter int unsigned RstCycles       = 1,
+    parameter int unsigned ClkEnPeriod     = 2,
+    parameter int unsigned BlockSize       = 512,
+    parameter int unsigned BlockCount      = 4,
+    parameter logic        Do4Bit          = 1'b1
+)();
+
+  sdhci_fixture #(
+    .ClkPeriod      (ClkPeriod),
+    .RstCycles      (RstCycles),
+    .SdBaseClk      (1'b1),
+    .SdBaseClkPeriod(SdBaseClkPeriod)
+  ) fixture ();
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d18, 'h3A);
+
+    // cmd12 with busy
+    fixture.vip.respond_48('d12, 'h7A);
+  end
+
+  initial begin : dat_response
+    logic [511:0][7:0] block;
+
+    for (int i = 0; i < 512; i++) begin
+      block[i] = 8'(i);
+    end
+
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    fixture.vip.send_blocks_until_cmd(block, BlockSize, Do4Bit);
+  end
+
+  initial begin : obi_driver
+    logic [31:0] expected_data;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.obi.set_system_address(.address('0), .finish_transaction(1'b0));
+
+    fixture.vip.start_data_command(
+      .command_index(6'd18),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(BlockCount),
+      .dma_enable(1'b1)
+    );
+
+    // cmd complete, transfer complete
+    fixture.vip.wait_irq('h03, BlockCount * (BlockSize * 8 + 500), "dma transfer complete");
+
+    fixture.vip.send_command(6'd12, 2'b11); // 48 bit with busy
+    fixture.vip.wait_irq('h03, BlockCount * (BlockSize * 8 + 500), "cmd12");
+
+    for (int i = 0; i < BlockCount * BlockSize / 4; i++) begin
+      for (int b = 0; b < 4; b++) begin
+        expected_data[b*8 +: 8] = 8'((i * 4 + b) % BlockSize);
+      end
+      if (fixture.memory[i] !== expected_data) begin
+        $fatal(1, "Unexpected data at word %0d, got %x, expected %x", i, fixture.memory[i], expected_data);
+      end
+    end
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
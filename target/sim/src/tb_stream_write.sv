@@ -0,0 +1,124 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Open ended pio write as used for streaming, stop at block gap is set right after the last block
+// was written to the buffer. Every buffered block still has to reach the card before the gap,
+// then CMD12 aborts the transfer.
+module tb_stream_write #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 2,
+    parameter int unsigned BlockSize     = 512,
+    parameter int unsigned NumBlocks     = 5,
+    parameter logic        Do4Bit        = 1'b1
+)();
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  int unsigned blocks_received = 0;
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d25, 'h4B);
+
+    // cmd12 with busy
+    fixture.vip.respond_48('d12, 'h7A);
+  end
+
+  initial begin : dat_response
+    fixture.vip.wait_for_reset();
+
+    repeat (NumBlocks) begin
+      fixture.vip.sd.wait_for_dat_held();
+      fixture.vip.sd.wait_for_dat_released();
+
+      // crc status after 2 idle cycles
+      fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.send_response_dat(.is_ok(1'b1));
+
+      fixture.vip.sd.claim_busy();
+      repeat(50) fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.release_busy();
+      blocks_received++;
+    end
+
+    // cmd12 with busy
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+    fixture.vip.sd.claim_busy();
+    repeat(50) fixture.vip.wait_for_sdclk();
+    fixture.vip.sd.release_busy();
+  end
+
+  initial begin : obi_driver
+    logic buffer_read_enable, buffer_write_enable;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.start_data_command(
+      .command_index(6'd25),
+      .is_read(1'b0),
+      .block_size(BlockSize),
+      .block_count(1),
+      .block_count_enable(1'b0)
+    );
+
+    fixture.vip.wait_irq('h01, NumBlocks * (BlockSize * 8 + 500), "cmd25 complete");
+
+    // refill as space frees up, like sdmmc_stream_append
+    repeat (NumBlocks) begin
+      do begin
+        fixture.vip.obi.get_present_status_buffer_enable(
+          .buffer_read_enable(buffer_read_enable),
+          .buffer_write_enable(buffer_write_enable)
+        );
+      end while (!buffer_write_enable);
+
+      repeat (BlockSize / 4) begin
+        fixture.vip.obi.write_buffer_data(.data(32'hdeadbeef), .finish_transaction(1'b1));
+      end
+    end
+
+    fixture.vip.obi.set_block_gap_control(
+      .stop_at_block_gap_request(1'b1),
+      .continue_request(1'b0),
+      .finish_transaction(1'b1)
+    );
+
+    fixture.vip.wait_irq('h04, NumBlocks * (BlockSize * 8 + 500), "block gap");
+    if (blocks_received != NumBlocks) begin
+      $fatal(1, "Stopped after %0d blocks, %0d were written", blocks_received, NumBlocks);
+    end
+
+    fixture.vip.obi.launch_command(
+      .command_index(6'd12),
+      .command_type (2'b11), // abort
+      .data_present (1'b0),
+      .index_check_enable(1'b1),
+      .crc_check_enable(1'b1),
+      .response_type(2'b11), // 48 bit with busy
+      .finish_transaction(1'b1)
+    );
+
+    fixture.vip.wait_irq('h03, NumBlocks * (BlockSize * 8 + 500), "cmd12 complete and transfer complete");
+
+    fixture.vip.obi.set_block_gap_control(
+      .stop_at_block_gap_request(1'b0),
+      .continue_request(1'b0),
+      .finish_transaction(1'b1)
+    );
+
+    repeat (100) fixture.vip.wait_for_sdclk();
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
@@ -0,0 +1,116 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Authors:
+// - Micha Wehrli <miwehrli@student.ethz.ch>
+
+// tb_block_gap that suspends the read at the first block gap instead of continuing it.
+// The suspend CMD12 ends the transfer, the block count is left at the blocks not read.
+module tb_suspend_resume #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 1,
+    parameter int unsigned BlockSize     = 512,
+    parameter int unsigned BlockCount    = 4,
+    parameter logic        Do4Bit        = 1'b1
+)();
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d18, 'h3A);
+
+    // cmd12 with busy
+    fixture.vip.respond_48('d12, 'h7A);
+  end
+
+  initial begin : dat_response
+    fixture.vip.wait_for_reset();
+
+    // wait for the read command
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    fixture.vip.send_blocks_until_cmd(fixture.vip.pattern_block(), BlockSize, Do4Bit);
+  end
+
+  initial begin : obi_driver
+    logic [15:0] block_count;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.obi.set_system_address(.address('0), .finish_transaction(1'b0));
+
+    fixture.vip.obi.set_block_gap_control(
+      .stop_at_block_gap_request(1'b1),
+      .continue_request(1'b0),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.start_data_command(
+      .command_index(6'd18),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(BlockCount),
+      .dma_enable(1'b1),
+      .auto_cmd12_enable(1'b1),
+      .dma_buffer_boundary(3'd7) // 512K, no dma interrupt
+    );
+
+    fixture.vip.wfi(200, "cmd18 complete");
+    fixture.vip.check_irq(
+      .expected_normal('h01), // cmd complete
+      .expected_error ('h0),  // no error
+      .error_context("cmd18 complete")
+    );
+
+    fixture.vip.wfi(BlockSize * 8 + 500, "block gap");
+    fixture.vip.check_irq(
+      .expected_normal('h04), // block gap event
+      .expected_error ('h0),  // no error
+      .error_context("block gap")
+    );
+
+    fixture.vip.obi.launch_command(
+      .command_index(6'd12),
+      .command_type (2'b01), // suspend
+      .data_present (1'b0),
+      .index_check_enable(1'b1),
+      .crc_check_enable(1'b1),
+      .response_type(2'b11), // 48 bit with busy
+      .finish_transaction(1'b1)
+    );
+
+    fixture.vip.wfi(BlockSize * 8 + 500, "suspend cmd12 complete and transfer complete");
+    fixture.vip.check_irq(
+      .expected_normal('h03), // cmd complete, transfer complete
+      .expected_error ('h0),  // no error
+      .error_context("suspend cmd12 complete and transfer complete")
+    );
+
+    fixture.vip.obi.get_block_count(block_count);
+    if (block_count != BlockCount - 1) begin
+      $fatal(1, "Block count after suspend is %0d, expected %0d", block_count, BlockCount - 1);
+    end
+
+    // no auto cmd12 and no more data may follow a suspended transfer
+    repeat (2 * BlockSize) fixture.vip.wait_for_sdclk();
+    fixture.vip.check_irq(
+      .expected_normal('h00),
+      .expected_error ('h0),
+      .error_context("suspended")
+    );
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
@@ -0,0 +1,124 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Runs the tuning procedure, the card answers every CMD19 with the tuning block.
+// Every tap sees a clean bus, so a sampling point has to be found and no tuning
+// data may end up in the buffer.
+module tb_tuning #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 4,
+    parameter int unsigned NumTuningTaps = 8
+)();
+
+  localparam int unsigned BlockSize = 64;
+
+  sdhci_fixture #(
+    .ClkPeriod    (ClkPeriod),
+    .RstCycles    (RstCycles),
+    .NumTuningTaps(NumTuningTaps)
+  ) fixture ();
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    repeat (NumTuningTaps) begin
+      fixture.vip.respond_48('d19, 'h0C);
+    end
+  end
+
+  initial begin : dat_response
+    logic [511:0][7:0] block;
+
+    block = '1;
+    for (int i = 0; i < sdhci_pkg::TuningBlockWords; i++) begin
+      for (int b = 0; b < 4; b++) begin
+        block[i * 4 + b] = sdhci_pkg::TuningBlock4Bit[i][b*8 +: 8];
+      end
+    end
+
+    fixture.vip.wait_for_reset();
+
+    repeat (NumTuningTaps) begin
+      fixture.vip.sd.wait_for_cmd_held();
+      fixture.vip.sd.wait_for_cmd_released();
+
+      fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.send_data_block(
+        .block(block),
+        .block_size(BlockSize),
+        .is_4_bit(1'b1)
+      );
+    end
+  end
+
+  initial begin : obi_driver
+    logic execute_tuning, sampling_clock_select;
+    logic [2:0] uhs_mode_select;
+    logic buffer_read_enable, buffer_write_enable;
+    int unsigned num_blocks;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(1'b1, ClkEnPeriod);
+
+    fixture.vip.obi.set_transfer_mode(
+      .is_multi_block(1'b0),
+      .is_read(1'b1),
+      .auto_cmd12_enable(1'b0),
+      .block_count_enable(1'b0),
+      .dma_enable(1'b0),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.obi.set_block_size_count(
+      .block_size(BlockSize),
+      .block_count(1),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.obi.set_host_control_2(
+      .execute_tuning(1'b1),
+      .sampling_clock_select(1'b0),
+      .uhs_mode_select(3'd3), // SDR104
+      .finish_transaction(1'b0)
+    );
+
+    num_blocks = 0;
+    do begin
+      fixture.vip.send_command(6'd19, 2'b10, 1'b1); // 48 bit no busy, with data
+
+      // cmd complete, transfer complete, buffer read ready
+      fixture.vip.wait_irq('h23, BlockSize * 8 + 500, "tuning block");
+      num_blocks++;
+
+      fixture.vip.obi.get_host_control_2(
+        .execute_tuning(execute_tuning),
+        .sampling_clock_select(sampling_clock_select),
+        .uhs_mode_select(uhs_mode_select)
+      );
+    end while (execute_tuning && num_blocks < NumTuningTaps);
+
+    if (execute_tuning || num_blocks != NumTuningTaps) begin
+      $fatal(1, "Tuning did not finish after %0d blocks", num_blocks);
+    end
+    if (!sampling_clock_select) begin
+      $fatal(1, "Tuning did not find a sampling point");
+    end
+
+    fixture.vip.obi.get_present_status_buffer_enable(
+      .buffer_read_enable(buffer_read_enable),
+      .buffer_write_enable(buffer_write_enable)
+    );
+    if (buffer_read_enable) begin
+      $fatal(1, "Tuning block ended up in the buffer");
+    end
+
+    repeat (100) fixture.vip.wait_for_sdclk();
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
@@ -0,0 +1,189 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Reads blocks through the buffer data window of a 64 bit bus. Every block is read with
+// whole bus words at incrementing window addresses, the padded last word of a block whose
+// size is not a multiple of 8 goes through the 32 bit buffer_data_port.
+// Afterwards a single block write is set up with one 64 bit access to the transfer mode and
+// command registers in the upper lane and the block is pushed through the window.
+module tb_wide_buffer_read #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 1,
+    parameter int unsigned BlockSize     = 20,
+    parameter int unsigned BlockCount    = 2,
+    parameter int unsigned WriteBlockSize = 16,
+    parameter logic        Do4Bit        = 1'b1
+)();
+
+  localparam int unsigned DataWidth = 64;
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles),
+    .DataWidth(DataWidth)
+  ) fixture ();
+
+  logic card_done, written_crc_ok;
+  logic [511:0][7:0] block, write_block, written_block;
+
+  initial begin
+    for (int i = 0; i < 512; i++) begin
+      block[i]       = 8'(i * 7 + 1);
+      write_block[i] = 8'(i * 3 + 5);
+    end
+  end
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d18, 'h3A);
+
+    fixture.vip.respond_48('d24, 'h7D);
+  end
+
+  initial begin : dat_response
+    card_done = 1'b0;
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+
+    repeat (BlockCount) begin
+      fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.send_data_block(
+        .block(block),
+        .block_size(BlockSize),
+        .is_4_bit(Do4Bit)
+      );
+      repeat(10) fixture.vip.wait_for_sdclk();
+    end
+    card_done = 1'b1;
+
+    fixture.vip.sd.receive_data_block(
+      .block(written_block),
+      .crc_ok(written_crc_ok),
+      .block_size(WriteBlockSize),
+      .is_4_bit(Do4Bit)
+    );
+    fixture.vip.sd.wait_for_dat_released();
+
+    // crc status after 2 idle cycles
+    fixture.vip.wait_for_sdclk();
+    fixture.vip.sd.send_response_dat(.is_ok(written_crc_ok));
+
+    fixture.vip.sd.claim_busy();
+    repeat(20) fixture.vip.wait_for_sdclk();
+    fixture.vip.sd.release_busy();
+  end
+
+  initial begin : obi_driver
+    logic [DataWidth-1:0] read_data, expected;
+    logic [31:0] read_word;
+    logic [15:0] transfer_mode;
+    logic [7:0]  window_width;
+
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.obi.get_buffer_data_window_width(.width(window_width));
+    if (window_width != DataWidth / 8) begin
+      $fatal(1, "Buffer data window is %0d bytes wide, expected %0d", window_width, DataWidth / 8);
+    end
+
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.start_data_command(
+      .command_index(6'd18),
+      .is_read(1'b1),
+      .block_size(BlockSize),
+      .block_count(BlockCount)
+    );
+
+    fork
+      begin
+        wait (card_done);
+      end
+      begin
+        repeat (BlockCount * (BlockSize * 8 + 500)) fixture.vip.wait_for_sdclk();
+        $fatal(1, "Card stalled");
+      end
+    join_any
+    disable fork;
+
+    fixture.vip.check_irq(
+      .expected_normal('h21), // cmd complete, data present
+      .expected_error ('h0),  // no error
+      .error_context("all blocks buffered")
+    );
+
+    repeat (BlockCount) begin
+      for (int unsigned i = 0; i < BlockSize / 8; i++) begin
+        fixture.vip.obi.read_buffer_window(.data(read_data), .offset(i * 8));
+        for (int unsigned b = 0; b < 8; b++) begin
+          expected[b*8 +: 8] = block[i * 8 + b];
+        end
+        if (read_data != expected) begin
+          $fatal(1, "Unexpected window data %x, expected %x", read_data, expected);
+        end
+      end
+      for (int unsigned i = BlockSize / 8 * 2; i < (BlockSize + 3) / 4; i++) begin
+        fixture.vip.obi.read_buffer_data(.data(read_word));
+        if (read_word != {block[i*4+3], block[i*4+2], block[i*4+1], block[i*4]}) begin
+          $fatal(1, "Unexpected buffer data %x in word %0d", read_word, i);
+        end
+      end
+    end
+
+    repeat (200) fixture.vip.wait_for_sdclk();
+    fixture.vip.check_irq(
+      .expected_normal('h22), // data present (retriggered per block), transfer complete
+      .expected_error ('h0),  // no error
+      .error_context("transfer complete")
+    );
+
+    fixture.vip.obi.set_block_size_count(
+      .block_size(WriteBlockSize),
+      .block_count(1),
+      .finish_transaction(1'b0)
+    );
+
+    // transfer mode and command in one access to the upper lane, single block write with the
+    // block count enabled
+    fixture.vip.obi.obi_write_wide(
+      'h00C, 8'hF0,
+      {2'b0, 6'd24, 2'b00, 1'b1, 1'b1, 1'b1, 1'b0, 2'b10, // cmd24, 48 bit no busy
+       16'h0002,                                          // block count enable
+       32'h0}
+    );
+
+    // cmd complete, buffer write ready
+    fixture.vip.wait_irq('h11, WriteBlockSize * 8 + 500, "cmd24 complete");
+
+    fixture.vip.obi.obi_read('h00C, 4'b0011, read_word);
+    transfer_mode = read_word[15:0];
+    if (transfer_mode != 16'h0002) begin
+      $fatal(1, "Transfer mode is %x after the 64 bit write, expected 0002", transfer_mode);
+    end
+
+    for (int unsigned i = 0; i < WriteBlockSize / 8; i++) begin
+      for (int unsigned b = 0; b < 8; b++) begin
+        expected[b*8 +: 8] = write_block[i * 8 + b];
+      end
+      fixture.vip.obi.write_buffer_window(.data(expected), .offset(i * 8));
+    end
+
+    fixture.vip.wait_irq('h02, WriteBlockSize * 8 + 500, "write transfer complete");
+
+    for (int unsigned i = 0; i < WriteBlockSize; i++) begin
+      if (written_block[i] != write_block[i]) begin
+        $fatal(1, "Card received %x in byte %0d, expected %x", written_block[i], i, write_block[i]);
+      end
+    end
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule
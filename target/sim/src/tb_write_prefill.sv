@@ -0,0 +1,149 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// Pio write with write_prefill, both blocks are written to the buffer before CMD25 is issued.
+// The first block has to follow the response without waiting for the host, and the buffer has to
+// be empty and open again once the write is over.
+module tb_write_prefill #(
+    parameter time         ClkPeriod     = 50ns,
+    parameter int unsigned RstCycles     = 1,
+    parameter int unsigned ClkEnPeriod   = 2,
+    parameter int unsigned BlockSize     = 512,
+    parameter int unsigned BlockCount    = 2, // fits into the buffer
+    parameter logic        Do4Bit        = 1'b1,
+    // sd_clk cycles from the end of the response to the first start bit
+    parameter int unsigned MaxStartDelay = 16
+)();
+
+  sdhci_fixture #(
+    .ClkPeriod(ClkPeriod),
+    .RstCycles(RstCycles)
+  ) fixture ();
+
+  event response_sent;
+
+  initial begin : cmd_response
+    fixture.vip.wait_for_reset();
+
+    fixture.vip.respond_48('d25, 'h4B);
+    -> response_sent;
+
+    // cmd12 with busy
+    fixture.vip.respond_48('d12, 'h7A);
+  end
+
+  initial begin : dat_response
+    fixture.vip.wait_for_reset();
+
+    @(response_sent);
+    fork
+      begin
+        fork
+          begin
+            fixture.vip.sd.wait_for_dat_held();
+          end
+          begin
+            repeat (MaxStartDelay) fixture.vip.wait_for_sdclk();
+            $fatal(1, "First block did not follow the response");
+          end
+        join_any
+        disable fork;
+      end
+    join
+
+    for (int unsigned i = 0; i < BlockCount; i++) begin
+      if (i != 0) begin
+        fixture.vip.sd.wait_for_dat_held();
+      end
+      fixture.vip.sd.wait_for_dat_released();
+
+      // crc status after 2 idle cycles
+      fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.send_response_dat(.is_ok(1'b1));
+
+      fixture.vip.sd.claim_busy();
+      repeat(20) fixture.vip.wait_for_sdclk();
+      fixture.vip.sd.release_busy();
+    end
+
+    // cmd12 with busy
+    fixture.vip.sd.wait_for_cmd_held();
+    fixture.vip.sd.wait_for_cmd_released();
+    fixture.vip.sd.claim_busy();
+    repeat(20) fixture.vip.wait_for_sdclk();
+    fixture.vip.sd.release_busy();
+  end
+
+  initial begin : obi_driver
+    logic buffer_read_enable, buffer_write_enable;
+    logic [15:0] block_count;
+
+    fixture.vip.wait_for_reset();
+    fixture.vip.setup_host(Do4Bit, ClkEnPeriod);
+
+    fixture.vip.obi.set_buffer_control(.write_prefill(1'b1), .finish_transaction(1'b0));
+
+    fixture.vip.obi.set_transfer_mode(
+      .is_multi_block(1'b1),
+      .is_read(1'b0),
+      .auto_cmd12_enable(1'b0),
+      .block_count_enable(1'b1),
+      .dma_enable(1'b0),
+      .finish_transaction(1'b0)
+    );
+
+    fixture.vip.obi.set_block_size_count(
+      .block_size(BlockSize),
+      .block_count(BlockCount),
+      .finish_transaction(1'b1)
+    );
+
+    repeat (BlockCount) begin
+      fixture.vip.obi.get_present_status_buffer_enable(
+        .buffer_read_enable(buffer_read_enable),
+        .buffer_write_enable(buffer_write_enable)
+      );
+      if (!buffer_write_enable) begin
+        $fatal(1, "Buffer is not open ahead of the command");
+      end
+      repeat (BlockSize / 4) begin
+        fixture.vip.obi.write_buffer_data(.data(32'hdeadbeef), .finish_transaction(1'b1));
+      end
+    end
+
+    fixture.vip.obi.get_present_status_buffer_enable(
+      .buffer_read_enable(buffer_read_enable),
+      .buffer_write_enable(buffer_write_enable)
+    );
+    if (buffer_write_enable) begin
+      $fatal(1, "Buffer should be full");
+    end
+
+    fixture.vip.send_command(6'd25, 2'b11, 1'b1); // 48 bit busy, with data
+
+    // cmd complete, transfer complete, no further data from the host
+    fixture.vip.wait_irq('h03, BlockCount * (BlockSize * 8 + 500), "prefilled write");
+
+    fixture.vip.obi.get_block_count(block_count);
+    if (block_count != 0) begin
+      $fatal(1, "Block count should be 0, got %0d", block_count);
+    end
+
+    fixture.vip.send_command(6'd12, 2'b11); // 48 bit with busy
+    fixture.vip.wait_irq('h03, BlockCount * (BlockSize * 8 + 500), "cmd12");
+
+    fixture.vip.obi.get_present_status_buffer_enable(
+      .buffer_read_enable(buffer_read_enable),
+      .buffer_write_enable(buffer_write_enable)
+    );
+    if (!buffer_write_enable) begin
+      $fatal(1, "Buffer should be empty and open for the next write");
+    end
+
+    $display("All good");
+
+    $finish();
+  end
+
+endmodule